@@ -13,6 +13,7 @@
 #include "battle_bg.h"
 #include "pokeball.h"
 #include "main.h"
+#include "math_util.h"
 
 #define GET_BATTLER_SIDE(battler)         (GetBattlerPosition(battler) & BIT_SIDE)
 #define GET_BATTLER_SIDE2(battler)        (gBattlerPositions[battler] & BIT_SIDE)
@@ -584,6 +585,9 @@ struct BattleBarInfo
     s32 oldValue;
     s32 receivedValue;
     s32 currValue;
+    struct Divisor maxValueDivisor; // Only valid if maxValue > 0
+    u8 drawnPixels[8]; // Fill of each bar tile currently in VRAM
+    u8 drawnGfxId;
 };
 
 struct BattleSpriteData
@@ -609,6 +613,8 @@ struct MonSpritesGfx
     u8 *barFontGfx;
     void *unusedPtr;
     u16 *buffer;
+    u32 hpTextGlyphs[2][12][8]; // Cached HP text characters, see battle_interface.c
+    bool8 hpTextGlyphsLoaded[2];
 };
 
 // All battle variables are declared in battle_main.c
@@ -32,6 +32,34 @@
 //       AGB_PRINT is supported on respective debug units.
 
 #define LOG_HANDLER (LOG_HANDLER_MGBA_PRINT)
+
+// Uncomment to log the peak sprite, task, OAM matrix, sprite palette and DMA
+// usage of every battle animation when it ends. The log can be ranked with
+// tools/animprof.
+//#define BATTLE_ANIM_PROFILER
+
+// Uncomment to log how many scanlines the Berry Blender, Berry Crush,
+// Dodrio Berry Picking and Pokemon Jump spend per frame on game logic,
+// link exchanges, sprites and bg updates. Printed as average/peak once
+// a second.
+//#define MINIGAME_PROFILER
+
+// Uncomment to log a hash of every field of the save blocks, PC storage and
+// battle structs at the end of each battle turn. Diff the logs of two games,
+// e.g. both sides of a link battle or a battle and its recording, with
+// tools/statediff to find the first field that diverged.
+//#define STATE_HASH_LOG
+
+// Uncomment to log a hash of the RNG, player position, party, tasks and
+// sprite positions after every frame. Replay the same inputs on two builds
+// and compare the logs with tools/statediff to find the first frame where
+// they stopped behaving the same.
+//#define FRAME_HASH_LOG
+
+// Uncomment to also hash each active task's data in FRAME_HASH_LOG. Tasks
+// keep pointers and other build-specific values there, so only compare
+// logs from the same build with this on.
+//#define FRAME_HASH_TASK_DATA
 #endif
 
 #define ENGLISH
@@ -47,6 +75,18 @@
 // Uncomment to fix some identified minor bugs
 //#define BUGFIX
 
+// Uncomment to draw frontier trainer parties only from the Pokemon that can
+// still join them, instead of redrawing whenever a pick is rejected. The same
+// RNG state then gives different parties than the original game, so link
+// battles and recorded battles with unmodified games won't match.
+//#define FRONTIER_PARTY_DIRECT_DRAW
+
+// Uncomment to give cosmetic effects like weather and the credits their own
+// RNG streams, so changing them no longer moves the gameplay RNG. Random()
+// then gets called fewer times than in the original game, which breaks RNG
+// manipulation and link or recorded battles with unmodified games.
+//#define COSMETIC_RNG_STREAMS
+
 // Various undefined behavior bugs may or may not prevent compilation with
 // newer compilers. So always fix them when using a modern compiler.
 #if MODERN || defined(BUGFIX)
@@ -46,6 +46,11 @@
 #define Dma3FillLarge16_(value, dest, size) Dma3FillLarge_(value, dest, size, 16)
 #define Dma3FillLarge32_(value, dest, size) Dma3FillLarge_(value, dest, size, 32)
 
+#ifdef BATTLE_ANIM_PROFILER
+// Running total of bytes moved by ProcessDma3Requests.
+extern u32 gDma3BytesTransferred;
+#endif
+
 void ClearDma3Requests(void);
 void ProcessDma3Requests(void);
 s16 RequestDma3Copy(const void *src, void *dest, u16 size, u8 mode);
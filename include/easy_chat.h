@@ -112,7 +112,9 @@ struct EasyChatScreenWordData
     u8 unused[44];
     u16 selectedGroupWords[EC_MAX_WORDS_IN_GROUP];
     u16 numSelectedGroupWords;
-}; /*size = 0x3BA4*/
+    u32 unlockedGroups; // One bit per group in unlockedGroupIds
+    u32 unlockedWords[EC_NUM_GROUPS][(EC_MASK_INDEX + 1) / 32]; // One bit per word index, regardless of whether its group is unlocked
+}; /*size = 0x4128*/
 
 struct EasyChatWordsByLetter
 {
@@ -0,0 +1,23 @@
+#ifndef GUARD_FRONTIER_PARTY_H
+#define GUARD_FRONTIER_PARTY_H
+
+#include "constants/items.h"
+#include "constants/species.h"
+
+// Species and held items that a randomly generated frontier team may not
+// repeat, so candidates can be rejected without rescanning the party.
+struct FrontierPartyExclusions
+{
+    u32 species[(NUM_SPECIES + 31) / 32];
+    u32 heldItems[(ITEMS_COUNT + 31) / 32];
+};
+
+void ClearFrontierPartyExclusions(struct FrontierPartyExclusions *exclusions);
+void AddFrontierPartyExclusion(struct FrontierPartyExclusions *exclusions, u16 species, u16 heldItem);
+void AddFrontierPartyHeldItemExclusion(struct FrontierPartyExclusions *exclusions, u16 heldItem);
+bool32 IsFrontierMonExcluded(const struct FrontierPartyExclusions *exclusions, u16 monId);
+bool32 CanAnyFrontierMonJoinParty(const struct FrontierPartyExclusions *exclusions, const u16 *monSet, u8 bfMonCount, bool32 highTierBanned);
+u8 InitFrontierPartyCandidates(u8 *candidates, const u16 *monSet, bool32 highTierBanned);
+u16 DrawFrontierPartyCandidate(const struct FrontierPartyExclusions *exclusions, const u16 *monSet, u8 *candidates, u8 *numCandidates);
+
+#endif // GUARD_FRONTIER_PARTY_H
@@ -1,6 +1,26 @@
 #ifndef GUARD_MATH_UTIL_H
 #define GUARD_MATH_UTIL_H
 
+// Precomputed reciprocal of a runtime divisor, see MathUtil_InitDivisor.
+struct Divisor
+{
+    u32 magic;
+    u8 shift1;
+    u8 shift2;
+};
+
+// From m4a_1.s
+u32 umul3232H32(u32 multiplier, u32 multiplicand);
+
+// ceil(2^32 / d), for constant divisors d >= 2.
+#define DIV_MAGIC(d) (0xFFFFFFFF / (d) + 1)
+
+// x / d for a constant d >= 2 and unsigned x, using a multiply instead of a
+// division. Only exact while x * d < 2^32, so the range of x must be known.
+#define UDIV_CONST(x, d) umul3232H32((x), DIV_MAGIC(d))
+
+extern const u32 gReciprocalTable[];
+
 s16 MathUtil_Mul16(s16 x, s16 y);
 s16 MathUtil_Mul16Shift(u8 s, s16 x, s16 y);
 s32 MathUtil_Mul32(s32 x, s32 y);
@@ -10,5 +30,8 @@ s32 MathUtil_Div32(s32 x, s32 y);
 s16 MathUtil_Inv16(s16 y);
 s16 MathUtil_Inv16Shift(u8 s, s16 y);
 s32 MathUtil_Inv32(s32 y);
+u32 MathUtil_DivSmall(u32 x, u32 d);
+void MathUtil_InitDivisor(struct Divisor *div, u32 d);
+u32 MathUtil_Divide(const struct Divisor *div, u32 x);
 
 #endif // GUARD_MATH_UTIL_H
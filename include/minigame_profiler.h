@@ -0,0 +1,28 @@
+#ifndef GUARD_MINIGAME_PROFILER_H
+#define GUARD_MINIGAME_PROFILER_H
+
+// Parts of a minigame's main callback that are timed separately. Link
+// exchanges run from inside the games' tasks, so LOGIC includes LINK.
+enum {
+    MINIGAME_PROF_LOGIC,   // Tasks and per-frame game state
+    MINIGAME_PROF_LINK,    // Sending and receiving link data
+    MINIGAME_PROF_SPRITES, // AnimateSprites and BuildOamBuffer
+    MINIGAME_PROF_BG,      // Text printers, palette fades and tilemap updates
+    MINIGAME_PROF_COUNT
+};
+
+#ifdef MINIGAME_PROFILER
+void MinigameProfiler_Begin(u8 scope);
+void MinigameProfiler_End(u8 scope);
+void MinigameProfiler_EndFrame(const char *game);
+
+#define MINIGAME_PROF_BEGIN(scope) MinigameProfiler_Begin(scope)
+#define MINIGAME_PROF_END(scope) MinigameProfiler_End(scope)
+#define MINIGAME_PROF_END_FRAME(game) MinigameProfiler_EndFrame(game)
+#else
+#define MINIGAME_PROF_BEGIN(scope)
+#define MINIGAME_PROF_END(scope)
+#define MINIGAME_PROF_END_FRAME(game)
+#endif
+
+#endif // GUARD_MINIGAME_PROFILER_H
@@ -501,6 +501,9 @@ void PartySpreadPokerus(struct Pokemon *party);
 bool8 TryIncrementMonLevel(struct Pokemon *mon);
 u32 CanMonLearnTMHM(struct Pokemon *mon, u8 tm);
 u32 CanSpeciesLearnTMHM(u16 species, u8 tm);
+u8 GetNextSpeciesTMHM(u16 species, u8 tm);
+u8 CountSpeciesTMHMs(u16 species);
+u8 CountLevelUpMovesUpToLevel(u16 species, u8 level);
 u8 GetMoveRelearnerMoves(struct Pokemon *mon, u16 *moves);
 u8 GetLevelUpMovesBySpecies(u16 species, u16 *moves);
 u8 GetNumberOfRelearnableMoves(struct Pokemon *mon);
@@ -16,6 +16,34 @@ u16 Random2(void);
 #define ISO_RANDOMIZE1(val) (1103515245 * (val) + 24691)
 #define ISO_RANDOMIZE2(val) (1103515245 * (val) + 12345)
 
+// Same as applying ISO_RANDOMIZE2 to val the given number of times.
+#define ISO_RANDOMIZE2_N(val, times) AdvanceLcg(val, 1103515245, 12345, times)
+
+// Streams for effects that don't affect gameplay, so they can draw numbers
+// without moving gRngValue.
+enum {
+    RNG_STREAM_WEATHER,
+    RNG_STREAM_UI,
+    RNG_STREAM_COUNT
+};
+
+// Cosmetic effects use their own stream with COSMETIC_RNG_STREAMS, which
+// keeps the gameplay RNG the same no matter how they're changed. Without it
+// they share Random() like in the original game.
+#ifdef COSMETIC_RNG_STREAMS
+#define CosmeticRandom(stream) RandomFromStream(stream)
+#else
+#define CosmeticRandom(stream) Random()
+#endif
+
+//Returns seed after steps iterations of seed * multiplier + increment, in O(log steps) time
+u32 AdvanceLcg(u32 seed, u32 multiplier, u32 increment, u32 steps);
+
+//Same as filling dest with count calls to Random()
+void RandomFill(u16 *dest, u32 count);
+
+u16 RandomFromStream(u32 stream);
+
 //Sets the initial seed value of the pseudorandom number generator
 void SeedRng(u16 seed);
 void SeedRng2(u16 seed);
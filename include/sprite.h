@@ -261,6 +261,7 @@ extern u16 gReservedSpriteTileCount;
 extern s16 gSpriteCoordOffsetX;
 extern s16 gSpriteCoordOffsetY;
 extern struct OamMatrix gOamMatrices[OAM_MATRIX_COUNT];
+extern u32 gOamMatrixAllocBitmap;
 extern bool8 gAffineAnimsDisabled;
 
 void ResetSpriteData(void);
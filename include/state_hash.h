@@ -0,0 +1,36 @@
+#ifndef GUARD_STATE_HASH_H
+#define GUARD_STATE_HASH_H
+
+// Parts of the game state that can be hashed. Two games whose hashes match
+// hold the same data, so both sides of a link, or a battle and its
+// recording, can compare them instead of the data itself.
+enum {
+    STATE_BLOCK_SAVEBLOCK1,
+    STATE_BLOCK_SAVEBLOCK2,
+    STATE_BLOCK_POKEMON_STORAGE,
+    STATE_BLOCK_BATTLE_MONS,
+    STATE_BLOCK_BATTLE_STRUCT,
+    STATE_BLOCK_COUNT
+};
+
+u32 HashStateData(const void *data, u32 size, u32 hash);
+u32 GetStateBlockHash(u32 block);
+u32 GetGameStateHash(void);
+
+#ifdef STATE_HASH_LOG
+void LogGameStateHashes(const char *event, u32 id);
+
+#define STATE_HASH_LOG_POINT(event, id) LogGameStateHashes(event, id)
+#else
+#define STATE_HASH_LOG_POINT(event, id)
+#endif
+
+#ifdef FRAME_HASH_LOG
+void LogFrameStateHash(void);
+
+#define FRAME_HASH_LOG_POINT() LogFrameStateHash()
+#else
+#define FRAME_HASH_LOG_POINT()
+#endif
+
+#endif // GUARD_STATE_HASH_H
@@ -2,10 +2,19 @@
 #define GUARD_TRIG_H
 
 extern const s16 gSineTable[];
+extern const s16 gSineFineTable[];
 
 s16 Sin(s16 index, s16 amplitude);
 s16 Cos(s16 index, s16 amplitude);
 s16 Sin2(u16 angle);
 s16 Cos2(u16 angle);
+s16 SinFine(u16 angle);
+s16 CosFine(u16 angle);
+void SinCosFine(u16 angle, s16 *sin, s16 *cos);
+void InitTrigBatchFuncs(void);
+void SinBatch(s16 *dest, u32 count, u16 index, u16 step, s16 amplitude);
+void SinCosBatch(s16 *dest, u32 count, u16 index, u16 step, s16 amplitude);
+void SinBatch_C(s16 *dest, u32 count, u16 index, u16 step, s16 amplitude);
+void SinCosBatch_C(s16 *dest, u32 count, u16 index, u16 step, s16 amplitude);
 
 #endif // GUARD_TRIG_H
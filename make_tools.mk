@@ -4,11 +4,17 @@
 MAKEFLAGS += --no-print-directory
 
 # Inclusive list. If you don't want a tool to be built, don't add it here.
+# This includes the tools that read what debug builds log (animprof,
+# statediff). They're small and need nothing else, so they're always built.
 TOOLS_DIR := tools
-TOOL_NAMES := bin2c gbafix gbagfx jsonproc mapjson mid2agb preproc ramscrgen rsfont scaninc wav2agb
+TOOL_NAMES := animprof bin2c gbafix gbagfx jsonproc mapjson mid2agb preproc ramscrgen rsfont scaninc statediff wav2agb
 
 TOOLDIRS := $(TOOL_NAMES:%=$(TOOLS_DIR)/%)
 
+# Host tests of game code. They are slow, so they only run with `make check-tools`.
+CHECK_TOOL_NAMES := bagtest eggtest learnsettest mathtest partybench strtest wildtest
+CHECK_TOOLDIRS := $(CHECK_TOOL_NAMES:%=$(TOOLS_DIR)/%)
+
 # Tool making doesnt require a pokeemerald dependency scan.
 RULES_NO_SCAN += tools check-tools clean-tools $(TOOLDIRS)
 .PHONY: $(RULES_NO_SCAN)
@@ -18,5 +24,8 @@ tools: $(TOOLDIRS)
 $(TOOLDIRS):
 	@$(MAKE) -C $@
 
+check-tools:
+	@$(foreach tooldir,$(CHECK_TOOLDIRS),$(MAKE) check -C $(tooldir) &&) true
+
 clean-tools:
-	@$(foreach tooldir,$(TOOLDIRS),$(MAKE) clean -C $(tooldir);)
+	@$(foreach tooldir,$(TOOLDIRS) $(CHECK_TOOLDIRS),$(MAKE) clean -C $(tooldir);)
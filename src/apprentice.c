@@ -351,13 +351,7 @@ static u16 GetRandomAlternateMove(u8 monId)
     else // == APPRENTICE_LVL_MODE_OPEN
         level = 60; // Despite being open level, level up moves are only read up to level 60
 
-    for (j = 0; learnset[j] != LEVEL_UP_END; j++)
-    {
-        if ((learnset[j] & LEVEL_UP_MOVE_LV) > (level << 9))
-            break;
-    }
-
-    numLearnsetMoves = j;
+    numLearnsetMoves = CountLevelUpMovesUpToLevel(species, level);
     i = 0;
 
     // i < 5 here is arbitrary, i isnt used and is only incremented when the selected move isnt in sValidApprenticeMoves
@@ -468,11 +462,7 @@ static void GetLatestLearnedMoves(u16 species, u16 *moves)
         level = 60;
 
     learnset = gLevelUpLearnsets[species];
-    for (i = 0; learnset[i] != LEVEL_UP_END; i++)
-    {
-        if ((learnset[i] & LEVEL_UP_MOVE_LV) > (level << 9))
-            break;
-    }
+    i = CountLevelUpMovesUpToLevel(species, level);
 
     numLearnsetMoves = i;
     if (numLearnsetMoves > MAX_MON_MOVES)
@@ -88,6 +88,11 @@ static void Task_LoopAndPlaySE(u8 taskId);
 static void Task_WaitAndPlaySE(u8 taskId);
 static void LoadDefaultBg(void);
 static void LoadMoveBg(u16 bgId);
+#ifdef BATTLE_ANIM_PROFILER
+static void StartAnimProfile(u16 tableId, bool8 isMoveAnim);
+static void SampleAnimProfile(void);
+static void PrintAnimProfile(void);
+#endif
 
 EWRAM_DATA static const u8 *sBattleAnimScriptPtr = NULL;
 EWRAM_DATA static const u8 *sBattleAnimScriptRetAddr = NULL;
@@ -113,6 +118,25 @@ EWRAM_DATA u8 gBattleAnimTarget = 0;
 EWRAM_DATA u16 gAnimBattlerSpecies[MAX_BATTLERS_COUNT] = {0};
 EWRAM_DATA u8 gAnimCustomPanning = 0;
 
+#ifdef BATTLE_ANIM_PROFILER
+// Peak resource usage of the animation currently running.
+struct BattleAnimProfile
+{
+    u16 tableId;
+    bool8 isMoveAnim;
+    u8 peakSprites;
+    u8 peakTasks;
+    u8 peakOamMatrices;
+    u8 peakSpritePalettes;
+    u16 frames;
+    u16 droppedFrames;
+    u32 lastVBlank;
+    u32 dmaBytesAtStart;
+};
+
+EWRAM_DATA static struct BattleAnimProfile sAnimProfile = {0};
+#endif
+
 #include "data/battle_anim.h"
 
 static void (*const sScriptCmdTable[])(void) =
@@ -261,6 +285,10 @@ void LaunchBattleAnimation(const u8 *const animsTable[], u16 tableId, bool8 isMo
     gBattle_WIN0V = 0;
     gBattle_WIN1H = 0;
     gBattle_WIN1V = 0;
+
+#ifdef BATTLE_ANIM_PROFILER
+    StartAnimProfile(tableId, isMoveAnim);
+#endif
 }
 
 void DestroyAnimSprite(struct Sprite *sprite)
@@ -312,6 +340,9 @@ static void ClearSpriteIndex(u16 index)
 
 static void WaitAnimFrameCount(void)
 {
+#ifdef BATTLE_ANIM_PROFILER
+    SampleAnimProfile();
+#endif
     if (sAnimFramesToWait <= 0)
     {
         gAnimScriptCallback = RunAnimScriptCommand;
@@ -325,6 +356,9 @@ static void WaitAnimFrameCount(void)
 
 static void RunAnimScriptCommand(void)
 {
+#ifdef BATTLE_ANIM_PROFILER
+    SampleAnimProfile();
+#endif
     do
     {
         sScriptCmdTable[sBattleAnimScriptPtr[0]]();
@@ -524,8 +558,87 @@ static void Cmd_end(void)
             UpdateOamPriorityInAllHealthboxes(1);
         }
         gAnimScriptActive = FALSE;
+#ifdef BATTLE_ANIM_PROFILER
+        PrintAnimProfile();
+#endif
+    }
+}
+
+#ifdef BATTLE_ANIM_PROFILER
+static void StartAnimProfile(u16 tableId, bool8 isMoveAnim)
+{
+    memset(&sAnimProfile, 0, sizeof(sAnimProfile));
+    sAnimProfile.tableId = tableId;
+    sAnimProfile.isMoveAnim = isMoveAnim;
+    sAnimProfile.lastVBlank = gMain.vblankCounter1;
+    sAnimProfile.dmaBytesAtStart = gDma3BytesTransferred;
+}
+
+// Called once per frame from whichever of the two script callbacks is active.
+static void SampleAnimProfile(void)
+{
+    s32 i, count;
+    u32 elapsed;
+
+    count = 0;
+    for (i = 0; i < MAX_SPRITES; i++)
+    {
+        if (gSprites[i].inUse)
+            count++;
     }
+    if (count > sAnimProfile.peakSprites)
+        sAnimProfile.peakSprites = count;
+
+    count = 0;
+    for (i = 0; i < NUM_TASKS; i++)
+    {
+        if (gTasks[i].isActive)
+            count++;
+    }
+    if (count > sAnimProfile.peakTasks)
+        sAnimProfile.peakTasks = count;
+
+    count = 0;
+    for (i = 0; i < OAM_MATRIX_COUNT; i++)
+    {
+        if (gOamMatrixAllocBitmap & (1 << i))
+            count++;
+    }
+    if (count > sAnimProfile.peakOamMatrices)
+        sAnimProfile.peakOamMatrices = count;
+
+    count = 0;
+    for (i = 0; i < 16; i++)
+    {
+        if (GetSpritePaletteTagByPaletteNum(i) != TAG_NONE)
+            count++;
+    }
+    if (count > sAnimProfile.peakSpritePalettes)
+        sAnimProfile.peakSpritePalettes = count;
+
+    // The script callback runs once per frame, so a gap of more than one
+    // VBlank means the previous frame overran.
+    elapsed = gMain.vblankCounter1 - sAnimProfile.lastVBlank;
+    if (elapsed > 1)
+        sAnimProfile.droppedFrames += elapsed - 1;
+    sAnimProfile.lastVBlank = gMain.vblankCounter1;
+    sAnimProfile.frames++;
+}
+
+static void PrintAnimProfile(void)
+{
+    DebugPrintf("ANIMPROF %s=%d sprites=%d tasks=%d matrices=%d palettes=%d dma=%d frames=%d dropped=%d",
+                sAnimProfile.isMoveAnim ? "move" : "anim",
+                sAnimProfile.tableId,
+                sAnimProfile.peakSprites,
+                sAnimProfile.peakTasks,
+                sAnimProfile.peakOamMatrices,
+                sAnimProfile.peakSpritePalettes,
+                gDma3BytesTransferred - sAnimProfile.dmaBytesAtStart,
+                sAnimProfile.frames,
+                sAnimProfile.droppedFrames);
 }
+#endif // BATTLE_ANIM_PROFILER
 
 static void Cmd_playse(void)
 {
@@ -109,7 +109,8 @@ static void CalcDomeMonStats(u16, int, int, u8, u8, int *);
 static void CreateDomeOpponentMons(u16);
 static int SelectOpponentMons_Good(u16, bool8);
 static int SelectOpponentMons_Bad(u16, bool8);
-static int GetTypeEffectivenessPoints(int, int, int);
+static void GetTypeMultipliers(u8 (*)[NUMBER_OF_MON_TYPES]);
+static int GetTypeEffectivenessPoints(int, int, int, u8 (*)[NUMBER_OF_MON_TYPES]);
 static int SelectOpponentMonsFromParty(int *, bool8);
 static void Task_ShowTourneyInfoCard(u8);
 static void Task_HandleInfoCardInput(u8);
@@ -2680,6 +2681,12 @@ static int SelectOpponentMons_Good(u16 tournamentTrainerId, bool8 allowRandom)
 {
     int i, moveIndex, playerMonId;
     int partyMovePoints[FRONTIER_PARTY_SIZE];
+    u16 playerSpecies[FRONTIER_PARTY_SIZE];
+    u8 typeMultipliers[NUMBER_OF_MON_TYPES][NUMBER_OF_MON_TYPES];
+
+    GetTypeMultipliers(typeMultipliers);
+    for (playerMonId = 0; playerMonId < FRONTIER_PARTY_SIZE; playerMonId++)
+        playerSpecies[playerMonId] = GetMonData(&gPlayerParty[playerMonId], MON_DATA_SPECIES, NULL);
 
     for (i = 0; i < FRONTIER_PARTY_SIZE; i++)
     {
@@ -2691,12 +2698,12 @@ static int SelectOpponentMons_Good(u16 tournamentTrainerId, bool8 allowRandom)
                 if (DOME_TRAINERS[tournamentTrainerId].trainerId == TRAINER_FRONTIER_BRAIN)
                 {
                     partyMovePoints[i] += GetTypeEffectivenessPoints(GetFrontierBrainMonMove(i, moveIndex),
-                                            GetMonData(&gPlayerParty[playerMonId], MON_DATA_SPECIES, NULL), EFFECTIVENESS_MODE_GOOD);
+                                            playerSpecies[playerMonId], EFFECTIVENESS_MODE_GOOD, typeMultipliers);
                 }
                 else
                 {
                     partyMovePoints[i] += GetTypeEffectivenessPoints(gFacilityTrainerMons[DOME_MONS[tournamentTrainerId][i]].moves[moveIndex],
-                                            GetMonData(&gPlayerParty[playerMonId], MON_DATA_SPECIES, NULL), EFFECTIVENESS_MODE_GOOD);
+                                            playerSpecies[playerMonId], EFFECTIVENESS_MODE_GOOD, typeMultipliers);
                 }
             }
         }
@@ -2709,6 +2716,12 @@ static int SelectOpponentMons_Bad(u16 tournamentTrainerId, bool8 allowRandom)
 {
     int i, moveIndex, playerMonId;
     int partyMovePoints[FRONTIER_PARTY_SIZE];
+    u16 playerSpecies[FRONTIER_PARTY_SIZE];
+    u8 typeMultipliers[NUMBER_OF_MON_TYPES][NUMBER_OF_MON_TYPES];
+
+    GetTypeMultipliers(typeMultipliers);
+    for (playerMonId = 0; playerMonId < FRONTIER_PARTY_SIZE; playerMonId++)
+        playerSpecies[playerMonId] = GetMonData(&gPlayerParty[playerMonId], MON_DATA_SPECIES, NULL);
 
     for (i = 0; i < FRONTIER_PARTY_SIZE; i++)
     {
@@ -2720,12 +2733,12 @@ static int SelectOpponentMons_Bad(u16 tournamentTrainerId, bool8 allowRandom)
                 if (DOME_TRAINERS[tournamentTrainerId].trainerId == TRAINER_FRONTIER_BRAIN)
                 {
                     partyMovePoints[i] += GetTypeEffectivenessPoints(GetFrontierBrainMonMove(i, moveIndex),
-                                            GetMonData(&gPlayerParty[playerMonId], MON_DATA_SPECIES, NULL), EFFECTIVENESS_MODE_BAD);
+                                            playerSpecies[playerMonId], EFFECTIVENESS_MODE_BAD, typeMultipliers);
                 }
                 else
                 {
                     partyMovePoints[i] += GetTypeEffectivenessPoints(gFacilityTrainerMons[DOME_MONS[tournamentTrainerId][i]].moves[moveIndex],
-                                            GetMonData(&gPlayerParty[playerMonId], MON_DATA_SPECIES, NULL), EFFECTIVENESS_MODE_BAD);
+                                            playerSpecies[playerMonId], EFFECTIVENESS_MODE_BAD, typeMultipliers);
                 }
             }
         }
@@ -2798,10 +2811,26 @@ static int SelectOpponentMonsFromParty(int *partyMovePoints, bool8 allowRandom)
 #define TYPE_x2     40
 #define TYPE_x4     80
 
-static int GetTypeEffectivenessPoints(int move, int targetSpecies, int mode)
+// Flattens gTypeEffectiveness into a [moveType][defType] table of TYPE_MUL_* values, so that
+// scoring a move doesn't have to search the whole list. Type pairs that aren't listed are
+// TYPE_MUL_NORMAL. The Foresight entries are included, as the list search didn't stop at them.
+static void GetTypeMultipliers(u8 (*typeMultipliers)[NUMBER_OF_MON_TYPES])
+{
+    int i;
+
+    memset(typeMultipliers, TYPE_MUL_NORMAL, sizeof(u8) * NUMBER_OF_MON_TYPES * NUMBER_OF_MON_TYPES);
+    for (i = 0; TYPE_EFFECT_ATK_TYPE(i) != TYPE_ENDTABLE; i += 3)
+    {
+        if (TYPE_EFFECT_ATK_TYPE(i) == TYPE_FORESIGHT)
+            continue;
+        typeMultipliers[TYPE_EFFECT_ATK_TYPE(i)][TYPE_EFFECT_DEF_TYPE(i)] = TYPE_EFFECT_MULTIPLIER(i);
+    }
+}
+
+static int GetTypeEffectivenessPoints(int move, int targetSpecies, int mode, u8 (*typeMultipliers)[NUMBER_OF_MON_TYPES])
 {
     int defType1, defType2, defAbility, moveType;
-    int i = 0;
+    int multiplier;
     int typePower = TYPE_x1;
 
     if (move == MOVE_NONE || move == MOVE_UNAVAILABLE || gBattleMoves[move].power == 0)
@@ -2828,30 +2857,21 @@ static int GetTypeEffectivenessPoints(int move, int targetSpecies, int mode)
     {
         // Calculate a "type power" value to determine the benefit of using this type move against the target.
         // This value will then be used to get the number of points to assign to the move.
-        while (TYPE_EFFECT_ATK_TYPE(i) != TYPE_ENDTABLE)
-        {
-            if (TYPE_EFFECT_ATK_TYPE(i) == TYPE_FORESIGHT)
-            {
-                i += 3;
-                continue;
-            }
-            if (TYPE_EFFECT_ATK_TYPE(i) == moveType)
-            {
-                // BUG: the value of TYPE_x2 does not exist in gTypeEffectiveness, so if defAbility is ABILITY_WONDER_GUARD, the conditional always fails
-                #ifndef BUGFIX
-                    #define WONDER_GUARD_EFFECTIVENESS TYPE_x2
-                #else
-                    #define WONDER_GUARD_EFFECTIVENESS TYPE_MUL_SUPER_EFFECTIVE
-                #endif
-                if (TYPE_EFFECT_DEF_TYPE(i) == defType1)
-                    if ((defAbility == ABILITY_WONDER_GUARD && TYPE_EFFECT_MULTIPLIER(i) == WONDER_GUARD_EFFECTIVENESS) || defAbility != ABILITY_WONDER_GUARD)
-                        typePower = (typePower * TYPE_EFFECT_MULTIPLIER(i)) / 10;
-                if (TYPE_EFFECT_DEF_TYPE(i) == defType2 && defType1 != defType2)
-                    if ((defAbility == ABILITY_WONDER_GUARD && TYPE_EFFECT_MULTIPLIER(i) == WONDER_GUARD_EFFECTIVENESS) || defAbility != ABILITY_WONDER_GUARD)
-                        typePower = (typePower * TYPE_EFFECT_MULTIPLIER(i)) / 10;
-            }
-            i += 3;
-        }
+        // Each type pair is listed at most once in gTypeEffectiveness, and no product loses precision,
+        // so applying the two defending types in this order gives the same result as the list order.
+        // BUG: the value of TYPE_x2 does not exist in gTypeEffectiveness, so if defAbility is ABILITY_WONDER_GUARD, the conditional always fails
+        #ifndef BUGFIX
+            #define WONDER_GUARD_EFFECTIVENESS TYPE_x2
+        #else
+            #define WONDER_GUARD_EFFECTIVENESS TYPE_MUL_SUPER_EFFECTIVE
+        #endif
+        multiplier = typeMultipliers[moveType][defType1];
+        if ((defAbility == ABILITY_WONDER_GUARD && multiplier == WONDER_GUARD_EFFECTIVENESS) || defAbility != ABILITY_WONDER_GUARD)
+            typePower = (typePower * multiplier) / 10;
+        multiplier = typeMultipliers[moveType][defType2];
+        if (defType1 != defType2)
+            if ((defAbility == ABILITY_WONDER_GUARD && multiplier == WONDER_GUARD_EFFECTIVENESS) || defAbility != ABILITY_WONDER_GUARD)
+                typePower = (typePower * multiplier) / 10;
     }
 
     switch (mode)
@@ -6024,7 +6044,9 @@ static void DecideRoundWinners(u8 roundId)
     int tournamentId1, tournamentId2;
     int species;
     int points1 = 0, points2 = 0;
+    u8 typeMultipliers[NUMBER_OF_MON_TYPES][NUMBER_OF_MON_TYPES];
 
+    GetTypeMultipliers(typeMultipliers);
     for (i = 0; i < DOME_TOURNAMENT_TRAINERS_COUNT; i++)
     {
         if (DOME_TRAINERS[i].isEliminated || DOME_TRAINERS[i].trainerId == TRAINER_PLAYER)
@@ -6063,7 +6085,7 @@ static void DecideRoundWinners(u8 roundId)
                     for (monId2 = 0; monId2 < FRONTIER_PARTY_SIZE; monId2++)
                     {
                         points1 += GetTypeEffectivenessPoints(gFacilityTrainerMons[DOME_MONS[tournamentId1][monId1]].moves[moveSlot],
-                                                gFacilityTrainerMons[DOME_MONS[tournamentId2][monId2]].species, EFFECTIVENESS_MODE_AI_VS_AI);
+                                                gFacilityTrainerMons[DOME_MONS[tournamentId2][monId2]].species, EFFECTIVENESS_MODE_AI_VS_AI, typeMultipliers);
                     }
                 }
                 species = gFacilityTrainerMons[DOME_MONS[tournamentId1][monId1]].species;
@@ -6086,7 +6108,7 @@ static void DecideRoundWinners(u8 roundId)
                     for (monId2 = 0; monId2 < FRONTIER_PARTY_SIZE; monId2++)
                     {
                         points2 += GetTypeEffectivenessPoints(gFacilityTrainerMons[DOME_MONS[tournamentId2][monId1]].moves[moveSlot],
-                                                gFacilityTrainerMons[DOME_MONS[tournamentId1][monId2]].species, EFFECTIVENESS_MODE_AI_VS_AI);
+                                                gFacilityTrainerMons[DOME_MONS[tournamentId1][monId2]].species, EFFECTIVENESS_MODE_AI_VS_AI, typeMultipliers);
                     }
                 }
                 species = gFacilityTrainerMons[DOME_MONS[tournamentId2][monId1]].species;
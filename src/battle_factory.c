@@ -7,6 +7,7 @@
 #include "overworld.h"
 #include "frontier_util.h"
 #include "battle_tower.h"
+#include "frontier_party.h"
 #include "random.h"
 #include "constants/battle_ai.h"
 #include "constants/battle_factory.h"
@@ -302,10 +303,8 @@ static void SetPerformedRentalSwap(void)
 
 static void GenerateOpponentMons(void)
 {
-    int i, j, k;
-    u16 species[FRONTIER_PARTY_SIZE];
-    u16 heldItems[FRONTIER_PARTY_SIZE];
-    int firstMonId = 0;
+    int i;
+    struct FrontierPartyExclusions exclusions;
     u16 trainerId = 0;
     u32 lvlMode = gSaveBlock2Ptr->frontier.lvlMode;
     u32 battleMode = VarGet(VAR_FRONTIER_BATTLE_MODE);
@@ -328,6 +327,11 @@ static void GenerateOpponentMons(void)
     if (gSaveBlock2Ptr->frontier.curChallengeBattleNum < FRONTIER_STAGES_PER_CHALLENGE - 1)
         gSaveBlock2Ptr->frontier.trainerIds[gSaveBlock2Ptr->frontier.curChallengeBattleNum] = trainerId;
 
+    // None of the opponent's Pokémon may be the same species as the potential rental Pokémon for the player
+    ClearFrontierPartyExclusions(&exclusions);
+    for (i = 0; i < (int)ARRAY_COUNT(gSaveBlock2Ptr->frontier.rentalMons); i++)
+        AddFrontierPartyExclusion(&exclusions, gFacilityTrainerMons[gSaveBlock2Ptr->frontier.rentalMons[i].monId].species, ITEM_NONE);
+
     i = 0;
     while (i != FRONTIER_PARTY_SIZE)
     {
@@ -337,40 +341,16 @@ static void GenerateOpponentMons(void)
         if (gFacilityTrainerMons[monId].species == SPECIES_UNOWN)
             continue;
 
-        // Ensure none of the opponent's Pokémon are the same as the potential rental Pokémon for the player
-        for (j = 0; j < (int)ARRAY_COUNT(gSaveBlock2Ptr->frontier.rentalMons); j++)
-        {
-            if (gFacilityTrainerMons[monId].species == gFacilityTrainerMons[gSaveBlock2Ptr->frontier.rentalMons[j].monId].species)
-                break;
-        }
-        if (j != (int)ARRAY_COUNT(gSaveBlock2Ptr->frontier.rentalMons))
-            continue;
-
         // "High tier" Pokémon are only allowed on open level mode
         if (lvlMode == FRONTIER_LVL_50 && monId > FRONTIER_MONS_HIGH_TIER)
             continue;
 
-        // Ensure this species hasn't already been chosen for the opponent
-        for (k = firstMonId; k < firstMonId + i; k++)
-        {
-            if (species[k] == gFacilityTrainerMons[monId].species)
-                break;
-        }
-        if (k != firstMonId + i)
-            continue;
-
-        // Ensure held items don't repeat on the opponent's team
-        for (k = firstMonId; k < firstMonId + i; k++)
-        {
-            if (heldItems[k] != ITEM_NONE && heldItems[k] == gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId])
-                break;
-        }
-        if (k != firstMonId + i)
+        // Ensure neither the species nor the held item repeat a rental or an earlier pick
+        if (IsFrontierMonExcluded(&exclusions, monId))
             continue;
 
         // Successful selection
-        species[i] = gFacilityTrainerMons[monId].species;
-        heldItems[i] = gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId];
+        AddFrontierPartyExclusion(&exclusions, gFacilityTrainerMons[monId].species, gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId]);
         gFrontierTempParty[i] = monId;
         i++;
     }
@@ -520,15 +500,15 @@ static void GenerateInitialRentalMons(void)
     u16 currSpecies;
     u16 species[PARTY_SIZE];
     u16 monIds[PARTY_SIZE];
-    u16 heldItems[PARTY_SIZE];
+    struct FrontierPartyExclusions heldItems;
 
     gFacilityTrainers = gBattleFrontierTrainers;
     for (i = 0; i < PARTY_SIZE; i++)
     {
         species[i] = SPECIES_NONE;
         monIds[i] = 0;
-        heldItems[i] = ITEM_NONE;
     }
+    ClearFrontierPartyExclusions(&heldItems);
     lvlMode = gSaveBlock2Ptr->frontier.lvlMode;
     battleMode = VarGet(VAR_FRONTIER_BATTLE_MODE);
     challengeNum = gSaveBlock2Ptr->frontier.factoryWinStreaks[battleMode][lvlMode] / FRONTIER_STAGES_PER_CHALLENGE;
@@ -580,21 +560,17 @@ static void GenerateInitialRentalMons(void)
             continue;
 
         // Cannot have two same held items.
-        for (j = firstMonId; j < firstMonId + i; j++)
+        // Only held items are added to the exclusions, as one duplicate species is allowed above.
+        if (IsFrontierMonExcluded(&heldItems, monId))
         {
-            if (heldItems[j] != ITEM_NONE && heldItems[j] == gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId])
-            {
-                if (gFacilityTrainerMons[monId].species == currSpecies)
-                    currSpecies = SPECIES_NONE;
-                break;
-            }
-        }
-        if (j != firstMonId + i)
+            if (gFacilityTrainerMons[monId].species == currSpecies)
+                currSpecies = SPECIES_NONE;
             continue;
+        }
 
         gSaveBlock2Ptr->frontier.rentalMons[i].monId = monId;
         species[i] = gFacilityTrainerMons[monId].species;
-        heldItems[i] = gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId];
+        AddFrontierPartyHeldItemExclusion(&heldItems, gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId]);
         monIds[i] = monId;
         i++;
     }
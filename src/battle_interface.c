@@ -161,6 +161,7 @@ enum
 static const u8 *GetHealthboxElementGfxPtr(u8);
 static u8 *AddTextPrinterAndCreateWindowOnHealthbox(const u8 *, u32, u32, u32, u32 *);
 
+static u8 *AddHpTextWindowOnHealthbox(const u8 *, u32, u32, u32 *);
 static void RemoveWindowOnHealthbox(u32 windowId);
 static void UpdateHpTextInHealthboxInDoubles(u8, s16, u8);
 static void UpdateStatusIconInHealthbox(u8);
@@ -184,9 +185,9 @@ static void SpriteCB_StatusSummaryBalls_OnSwitchout(struct Sprite *);
 
 static u8 GetStatusIconForBattlerId(u8, u8);
 static s32 CalcNewBarValue(s32, s32, s32, s32 *, u8, u16);
-static u8 GetScaledExpFraction(s32, s32, s32, u8);
+static u8 GetScaledExpFraction(s32, s32, s32, const struct Divisor *, u8);
 static void MoveBattleBarGraphically(u8, u8);
-static u8 CalcBarFilledPixels(s32, s32, s32, s32 *, u8 *, u8);
+static u8 CalcBarFilledPixels(s32, s32, s32, const struct Divisor *, s32 *, u8 *, u8);
 static void Debug_TestHealthBar_Helper(struct TestingBar *, s32 *, u16 *);
 
 static const struct OamData sOamData_64x32 =
@@ -739,6 +740,15 @@ static const struct SpriteTemplate sStatusSummaryBallsSpriteTemplates[2] =
 static const u8 sEmptyWhiteText_GrayHighlight[] = __("{COLOR WHITE}{HIGHLIGHT DARK_GRAY}              ");
 static const u8 sEmptyWhiteText_TransparentHighlight[] = __("{COLOR WHITE}{HIGHLIGHT TRANSPARENT}              ");
 
+// HP numbers are only ever made of these characters, which are all the same width in FONT_SMALL.
+// Their glyphs are cached in gMonSpritesGfxPtr->hpTextGlyphs, so that the numbers can be redrawn
+// on every frame of a health bar animation without running the text printer.
+static const u8 sHpTextChars[] = {
+    CHAR_SPACER, CHAR_0, CHAR_1, CHAR_2, CHAR_3, CHAR_4, CHAR_5, CHAR_6, CHAR_7, CHAR_8, CHAR_9, CHAR_SLASH, EOS
+};
+
+#define HP_TEXT_GLYPH_WIDTH 5
+
 enum
 {
     PAL_STATUS_PSN,
@@ -1019,6 +1029,11 @@ void SetBattleBarStruct(u8 battler, u8 healthboxSpriteId, s32 maxVal, s32 oldVal
     gBattleSpritesDataPtr->battleBars[battler].oldValue = oldVal;
     gBattleSpritesDataPtr->battleBars[battler].receivedValue = receivedValue;
     gBattleSpritesDataPtr->battleBars[battler].currValue = -32768;
+    // Nothing is known about what's in VRAM, so the first draw has to upload every tile
+    memset(gBattleSpritesDataPtr->battleBars[battler].drawnPixels, 0xFF, sizeof(gBattleSpritesDataPtr->battleBars[battler].drawnPixels));
+    // The bar divides by maxValue several times every frame until it's done moving
+    if (maxVal > 0)
+        MathUtil_InitDivisor(&gBattleSpritesDataPtr->battleBars[battler].maxValueDivisor, maxVal);
 }
 
 void SetHealthboxSpriteInvisible(u8 healthboxSpriteId)
@@ -1149,7 +1164,7 @@ void UpdateHpTextInHealthbox(u8 healthboxSpriteId, s16 value, u8 maxOrCurrent)
         if (maxOrCurrent != HP_CURRENT) // singles, max
         {
             ConvertIntToDecimalStringN(text, value, STR_CONV_MODE_RIGHT_ALIGN, 3);
-            windowTileData = AddTextPrinterAndCreateWindowOnHealthbox(text, 0, 5, 2, &windowId);
+            windowTileData = AddHpTextWindowOnHealthbox(text, 0, 2, &windowId);
             objVram = (void *)(OBJ_VRAM0);
             objVram += spriteTileNum + 0xB40;
             HpTextIntoHealthboxObject(objVram, windowTileData, 2);
@@ -1160,7 +1175,7 @@ void UpdateHpTextInHealthbox(u8 healthboxSpriteId, s16 value, u8 maxOrCurrent)
             ConvertIntToDecimalStringN(text, value, STR_CONV_MODE_RIGHT_ALIGN, 3);
             text[3] = CHAR_SLASH;
             text[4] = EOS;
-            windowTileData = AddTextPrinterAndCreateWindowOnHealthbox(text, 4, 5, 2, &windowId);
+            windowTileData = AddHpTextWindowOnHealthbox(text, 4, 2, &windowId);
             objVram = (void *)(OBJ_VRAM0);
             objVram += spriteTileNum + 0x3E0;
             HpTextIntoHealthboxObject(objVram, windowTileData, 1);
@@ -1230,7 +1245,7 @@ static void UpdateHpTextInHealthboxInDoubles(u8 healthboxSpriteId, s16 value, u8
             if (maxOrCurrent != HP_CURRENT) // doubles, max hp
             {
                 ConvertIntToDecimalStringN(text, value, STR_CONV_MODE_RIGHT_ALIGN, 3);
-                windowTileData = AddTextPrinterAndCreateWindowOnHealthbox(text, 0, 5, 0, &windowId);
+                windowTileData = AddHpTextWindowOnHealthbox(text, 0, 0, &windowId);
                 HpTextIntoHealthboxObject((void *)(OBJ_VRAM0) + spriteTileNum + 0xC0, windowTileData, 2);
                 RemoveWindowOnHealthbox(windowId);
                 CpuCopy32(GetHealthboxElementGfxPtr(HEALTHBOX_GFX_FRAME_END),
@@ -1242,7 +1257,7 @@ static void UpdateHpTextInHealthboxInDoubles(u8 healthboxSpriteId, s16 value, u8
                 ConvertIntToDecimalStringN(text, value, STR_CONV_MODE_RIGHT_ALIGN, 3);
                 text[3] = CHAR_SLASH;
                 text[4] = EOS;
-                windowTileData = AddTextPrinterAndCreateWindowOnHealthbox(text, 4, 5, 0, &windowId);
+                windowTileData = AddHpTextWindowOnHealthbox(text, 4, 0, &windowId);
                 FillHealthboxObject(objVram, 0, 3); // Erases HP bar leftover.
                 HpTextIntoHealthboxObject((void *)(OBJ_VRAM0 + 0x60) + spriteTileNum, windowTileData, 3);
                 RemoveWindowOnHealthbox(windowId);
@@ -2251,10 +2266,11 @@ s32 MoveBattleBar(u8 battler, u8 healthboxSpriteId, u8 whichBar, u8 unused)
     {
         u16 expFraction = GetScaledExpFraction(gBattleSpritesDataPtr->battleBars[battler].oldValue,
                     gBattleSpritesDataPtr->battleBars[battler].receivedValue,
-                    gBattleSpritesDataPtr->battleBars[battler].maxValue, 8);
+                    gBattleSpritesDataPtr->battleBars[battler].maxValue,
+                    &gBattleSpritesDataPtr->battleBars[battler].maxValueDivisor, 8);
         if (expFraction == 0)
             expFraction = 1;
-        expFraction = abs(gBattleSpritesDataPtr->battleBars[battler].receivedValue / expFraction);
+        expFraction = MathUtil_DivSmall(abs(gBattleSpritesDataPtr->battleBars[battler].receivedValue), expFraction);
 
         currentBarValue = CalcNewBarValue(gBattleSpritesDataPtr->battleBars[battler].maxValue,
                     gBattleSpritesDataPtr->battleBars[battler].oldValue,
@@ -2278,6 +2294,7 @@ static void MoveBattleBarGraphically(u8 battler, u8 whichBar)
     u8 filledPixelsCount, level;
     u8 barElementId;
     u8 i;
+    struct BattleBarInfo *bar = &gBattleSpritesDataPtr->battleBars[battler];
 
     switch (whichBar)
     {
@@ -2285,6 +2302,7 @@ static void MoveBattleBarGraphically(u8 battler, u8 whichBar)
         filledPixelsCount = CalcBarFilledPixels(gBattleSpritesDataPtr->battleBars[battler].maxValue,
                             gBattleSpritesDataPtr->battleBars[battler].oldValue,
                             gBattleSpritesDataPtr->battleBars[battler].receivedValue,
+                            &gBattleSpritesDataPtr->battleBars[battler].maxValueDivisor,
                             &gBattleSpritesDataPtr->battleBars[battler].currValue,
                             array, B_HEALTHBAR_PIXELS / 8);
 
@@ -2295,9 +2313,18 @@ static void MoveBattleBarGraphically(u8 battler, u8 whichBar)
         else
             barElementId = HEALTHBOX_GFX_HP_BAR_RED; // 20 % or less
 
+        // Changing color means every tile has to be redrawn
+        if (barElementId != bar->drawnGfxId)
+            memset(bar->drawnPixels, 0xFF, sizeof(bar->drawnPixels));
+        bar->drawnGfxId = barElementId;
+
         for (i = 0; i < 6; i++)
         {
             u8 healthbarSpriteId = gSprites[gBattleSpritesDataPtr->battleBars[battler].healthboxSpriteId].hMain_HealthBarSpriteId;
+            // Only upload the tiles whose fill changed since they were last drawn
+            if (array[i] == bar->drawnPixels[i])
+                continue;
+            bar->drawnPixels[i] = array[i];
             if (i < 2)
                 CpuCopy32(GetHealthboxElementGfxPtr(barElementId) + array[i] * 32,
                           (void *)(OBJ_VRAM0 + (gSprites[healthbarSpriteId].oam.tileNum + 2 + i) * TILE_SIZE_4BPP), 32);
@@ -2310,6 +2337,7 @@ static void MoveBattleBarGraphically(u8 battler, u8 whichBar)
         CalcBarFilledPixels(gBattleSpritesDataPtr->battleBars[battler].maxValue,
                     gBattleSpritesDataPtr->battleBars[battler].oldValue,
                     gBattleSpritesDataPtr->battleBars[battler].receivedValue,
+                    &gBattleSpritesDataPtr->battleBars[battler].maxValueDivisor,
                     &gBattleSpritesDataPtr->battleBars[battler].currValue,
                     array, B_EXPBAR_PIXELS / 8);
         level = GetMonData(&gPlayerParty[gBattlerPartyIndexes[battler]], MON_DATA_LEVEL);
@@ -2320,6 +2348,9 @@ static void MoveBattleBarGraphically(u8 battler, u8 whichBar)
         }
         for (i = 0; i < 8; i++)
         {
+            if (array[i] == bar->drawnPixels[i])
+                continue;
+            bar->drawnPixels[i] = array[i];
             if (i < 4)
                 CpuCopy32(GetHealthboxElementGfxPtr(HEALTHBOX_GFX_12) + array[i] * 32,
                           (void *)(OBJ_VRAM0 + (gSprites[gBattleSpritesDataPtr->battleBars[battler].healthboxSpriteId].oam.tileNum + 0x24 + i) * TILE_SIZE_4BPP), 32);
@@ -2410,7 +2441,15 @@ static s32 CalcNewBarValue(s32 maxValue, s32 oldValue, s32 receivedValue, s32 *c
     return ret;
 }
 
-static u8 CalcBarFilledPixels(s32 maxValue, s32 oldValue, s32 receivedValue, s32 *currValue, u8 *pixelsArray, u8 scale)
+// value / maxValue, using maxValueDivisor when the result can't differ from a signed division
+static s32 DivideByBarMax(s32 value, s32 maxValue, const struct Divisor *maxValueDivisor)
+{
+    if (maxValueDivisor != NULL && value >= 0 && maxValue > 0)
+        return MathUtil_Divide(maxValueDivisor, value);
+    return value / maxValue;
+}
+
+static u8 CalcBarFilledPixels(s32 maxValue, s32 oldValue, s32 receivedValue, const struct Divisor *maxValueDivisor, s32 *currValue, u8 *pixelsArray, u8 scale)
 {
     u8 pixels, filledPixels, totalPixels;
     u8 i;
@@ -2427,9 +2466,9 @@ static u8 CalcBarFilledPixels(s32 maxValue, s32 oldValue, s32 receivedValue, s32
         pixelsArray[i] = 0;
 
     if (maxValue < totalPixels)
-        pixels = (*currValue * totalPixels / maxValue) >> 8;
+        pixels = DivideByBarMax(*currValue * totalPixels, maxValue, maxValueDivisor) >> 8;
     else
-        pixels = *currValue * totalPixels / maxValue;
+        pixels = DivideByBarMax(*currValue * totalPixels, maxValue, maxValueDivisor);
 
     filledPixels = pixels;
 
@@ -2486,7 +2525,7 @@ static void Debug_TestHealthBar_Helper(struct TestingBar *barInfo, s32 *currValu
     u8 i;
 
     CalcBarFilledPixels(barInfo->maxValue, barInfo->oldValue,
-                barInfo->receivedValue, currValue, pixels, B_HEALTHBAR_PIXELS / 8);
+                barInfo->receivedValue, NULL, currValue, pixels, B_HEALTHBAR_PIXELS / 8);
 
     for (i = 0; i < 6; i++)
         src[i] = (barInfo->unkC_0 << 12) | (barInfo->unk10 + pixels[i]);
@@ -2494,7 +2533,7 @@ static void Debug_TestHealthBar_Helper(struct TestingBar *barInfo, s32 *currValu
     CpuCopy16(src, dest, sizeof(src));
 }
 
-static u8 GetScaledExpFraction(s32 oldValue, s32 receivedValue, s32 maxValue, u8 scale)
+static u8 GetScaledExpFraction(s32 oldValue, s32 receivedValue, s32 maxValue, const struct Divisor *maxValueDivisor, u8 scale)
 {
     s32 newVal, result;
     s8 oldToMax, newToMax;
@@ -2507,8 +2546,8 @@ static u8 GetScaledExpFraction(s32 oldValue, s32 receivedValue, s32 maxValue, u8
     else if (newVal > maxValue)
         newVal = maxValue;
 
-    oldToMax = oldValue * scale / maxValue;
-    newToMax = newVal * scale / maxValue;
+    oldToMax = DivideByBarMax(oldValue * scale, maxValue, maxValueDivisor);
+    newToMax = DivideByBarMax(newVal * scale, maxValue, maxValueDivisor);
     result = oldToMax - newToMax;
 
     return abs(result);
@@ -2567,6 +2606,97 @@ static u8 *AddTextPrinterAndCreateWindowOnHealthbox(const u8 *str, u32 x, u32 y,
     return (u8 *)(GetWindowAttribute(winId, WINDOW_TILE_DATA));
 }
 
+static u32 GetHealthboxTextPixel(const u8 *tiles, u32 x, u32 y)
+{
+    u8 pixels = tiles[(x / 8) * TILE_SIZE_4BPP + y * 4 + (x % 8) / 2];
+
+    if (x & 1)
+        return pixels >> 4;
+    else
+        return pixels & 0xF;
+}
+
+static void SetHealthboxTextPixel(u8 *tiles, u32 x, u32 y, u32 color)
+{
+    u8 *pixels = &tiles[(x / 8) * TILE_SIZE_4BPP + y * 4 + (x % 8) / 2];
+
+    if (x & 1)
+        *pixels = (*pixels & 0xF) | (color << 4);
+    else
+        *pixels = (*pixels & 0xF0) | color;
+}
+
+static u32 GetHpTextGlyphId(u8 c)
+{
+    u32 i;
+
+    for (i = 0; sHpTextChars[i] != EOS; i++)
+    {
+        if (sHpTextChars[i] == c)
+            break;
+    }
+    return i;
+}
+
+// Prints all of sHpTextChars once and keeps the part of each glyph that ends up in the healthbox.
+static void LoadHpTextGlyphs(u32 bgColor)
+{
+    u32 windowId, i, x, y, row;
+    u8 *tiles;
+    u32 (*glyphs)[8] = gMonSpritesGfxPtr->hpTextGlyphs[bgColor != 0];
+
+    tiles = AddTextPrinterAndCreateWindowOnHealthbox(sHpTextChars, 0, 5, bgColor, &windowId);
+    tiles += sHealthboxWindowTemplate.width * TILE_SIZE_4BPP;
+    for (i = 0; sHpTextChars[i] != EOS; i++)
+    {
+        for (y = 0; y < 8; y++)
+        {
+            row = 0;
+            for (x = 0; x < HP_TEXT_GLYPH_WIDTH; x++)
+                row |= GetHealthboxTextPixel(tiles, i * HP_TEXT_GLYPH_WIDTH + x, y) << (x * 4);
+            glyphs[i][y] = row;
+        }
+    }
+    RemoveWindowOnHealthbox(windowId);
+    gMonSpritesGfxPtr->hpTextGlyphsLoaded[bgColor != 0] = TRUE;
+}
+
+// Same as AddTextPrinterAndCreateWindowOnHealthbox with y = 5, but draws from the cached glyphs.
+// Only the second row of tiles is drawn, as that's all the HP text copies into the healthbox.
+static u8 *AddHpTextWindowOnHealthbox(const u8 *str, u32 x, u32 bgColor, u32 *windowId)
+{
+    u16 winId;
+    u32 i, y, px, row;
+    u8 *tiles;
+    u32 (*glyphs)[8] = gMonSpritesGfxPtr->hpTextGlyphs[bgColor != 0];
+
+    for (i = 0; str[i] != EOS; i++)
+    {
+        if (GetHpTextGlyphId(str[i]) == ARRAY_COUNT(sHpTextChars) - 1)
+            return AddTextPrinterAndCreateWindowOnHealthbox(str, x, 5, bgColor, windowId);
+    }
+
+    if (!gMonSpritesGfxPtr->hpTextGlyphsLoaded[bgColor != 0])
+        LoadHpTextGlyphs(bgColor);
+
+    winId = AddWindow(&sHealthboxWindowTemplate);
+    FillWindowPixelBuffer(winId, PIXEL_FILL(bgColor));
+    tiles = (u8 *)(GetWindowAttribute(winId, WINDOW_TILE_DATA));
+
+    for (i = 0; str[i] != EOS; i++, x += HP_TEXT_GLYPH_WIDTH)
+    {
+        for (y = 0; y < 8; y++)
+        {
+            row = glyphs[GetHpTextGlyphId(str[i])][y];
+            for (px = 0; px < HP_TEXT_GLYPH_WIDTH; px++, row >>= 4)
+                SetHealthboxTextPixel(tiles + sHealthboxWindowTemplate.width * TILE_SIZE_4BPP, x + px, y, row & 0xF);
+        }
+    }
+
+    *windowId = winId;
+    return tiles;
+}
+
 static void RemoveWindowOnHealthbox(u32 windowId)
 {
     RemoveWindow(windowId);
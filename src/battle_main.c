@@ -41,6 +41,7 @@
 #include "scanline_effect.h"
 #include "sound.h"
 #include "sprite.h"
+#include "state_hash.h"
 #include "string_util.h"
 #include "strings.h"
 #include "task.h"
@@ -3039,6 +3040,7 @@ static void BattleStartClearSetData(void)
 
     TurnValuesCleanUp(FALSE);
     SpecialStatusesClear();
+    ClearBattleNicknameCache();
 
     for (i = 0; i < MAX_BATTLERS_COUNT; i++)
     {
@@ -3972,6 +3974,7 @@ void BattleTurnPassed(void)
         return;
 
     TurnValuesCleanUp(FALSE);
+    ClearBattleNicknameCache();
     gHitMarker &= ~HITMARKER_NO_ATTACKSTRING;
     gHitMarker &= ~HITMARKER_UNABLE_TO_USE_MOVE;
     gHitMarker &= ~HITMARKER_PLAYER_FAINTED;
@@ -4011,6 +4014,7 @@ void BattleTurnPassed(void)
     BattlePutTextOnWindow(gText_EmptyString3, B_WIN_MSG);
     gBattleMainFunc = HandleTurnActionSelectionState;
     gRandomTurnNumber = Random();
+    STATE_HASH_LOG_POINT("turn", gBattleResults.battleTurnCounter);
 
     if (gBattleTypeFlags & BATTLE_TYPE_PALACE)
         BattleScriptExecute(BattleScript_PalacePrintFlavorText);
@@ -46,8 +46,13 @@ struct BattleWindowText
 static void ChooseMoveUsedParticle(u8 *textPtr);
 static void ChooseTypeOfMoveUsedString(u8 *dst);
 static void ExpandBattleTextBuffPlaceholders(const u8 *src, u8 *dst);
+static const u8 *GetBattleNickname(u32 side, u32 partyId);
 
 static EWRAM_DATA u8 sBattlerAbilities[MAX_BATTLERS_COUNT] = {0};
+// Getting a nickname decrypts the mon's substructs, and multi-hit moves name
+// the same mons once per hit. Nicknames are kept here until the turn ends.
+static EWRAM_DATA u8 sNicknameCache[NUM_BATTLE_SIDES][PARTY_SIZE][POKEMON_NAME_LENGTH + 1] = {0};
+static EWRAM_DATA u16 sNicknameCacheFlags = 0;
 EWRAM_DATA struct BattleMsgData *gBattleMsgDataPtr = NULL;
 
 // todo: make some of those names less vague: attacker/target vs pkmn, etc.
@@ -2290,20 +2295,13 @@ static const u8 *TryGetStatusString(u8 *src)
             toCpy = sText_FoePkmnPrefix;                                \
         else                                                            \
             toCpy = sText_WildPkmnPrefix;                               \
-        while (*toCpy != EOS)                                           \
-        {                                                               \
-            dst[dstID] = *toCpy;                                        \
-            dstID++;                                                    \
-            toCpy++;                                                    \
-        }                                                               \
-        GetMonData(&gEnemyParty[monIndex], MON_DATA_NICKNAME, text);    \
+        dstID = StringCopy(&dst[dstID], toCpy) - dst;                   \
+        toCpy = GetBattleNickname(B_SIDE_OPPONENT, monIndex);           \
     }                                                                   \
     else                                                                \
     {                                                                   \
-        GetMonData(&gPlayerParty[monIndex], MON_DATA_NICKNAME, text);   \
-    }                                                                   \
-    StringGet_Nickname(text);                                           \
-    toCpy = text;
+        toCpy = GetBattleNickname(B_SIDE_PLAYER, monIndex);             \
+    }
 
 // Ensure the defined length for an item name can contain the full defined length of a berry name.
 // This ensures that custom Enigma Berry names will fit in the text buffer at the top of BattleStringExpandPlaceholders.
@@ -2313,7 +2311,7 @@ u32 BattleStringExpandPlaceholders(const u8 *src, u8 *dst)
 {
     u32 dstID = 0; // if they used dstID, why not use srcID as well?
     const u8 *toCpy = NULL;
-    // This buffer may hold either the name of a trainer, Pokémon, or item.
+    // This buffer may hold either the name of a trainer or an item.
     u8 text[max(max(max(32, TRAINER_NAME_LENGTH + 1), POKEMON_NAME_LENGTH + 1), ITEM_NAME_LENGTH)];
     u8 multiplayerId;
     s32 i;
@@ -2375,65 +2373,36 @@ u32 BattleStringExpandPlaceholders(const u8 *src, u8 *dst)
                 toCpy = gStringVar3;
                 break;
             case B_TXT_PLAYER_MON1_NAME: // first player poke name
-                GetMonData(&gPlayerParty[gBattlerPartyIndexes[GetBattlerAtPosition(B_POSITION_PLAYER_LEFT)]],
-                           MON_DATA_NICKNAME, text);
-                StringGet_Nickname(text);
-                toCpy = text;
+                toCpy = GetBattleNickname(B_SIDE_PLAYER, gBattlerPartyIndexes[GetBattlerAtPosition(B_POSITION_PLAYER_LEFT)]);
                 break;
             case B_TXT_OPPONENT_MON1_NAME: // first enemy poke name
-                GetMonData(&gEnemyParty[gBattlerPartyIndexes[GetBattlerAtPosition(B_POSITION_OPPONENT_LEFT)]],
-                           MON_DATA_NICKNAME, text);
-                StringGet_Nickname(text);
-                toCpy = text;
+                toCpy = GetBattleNickname(B_SIDE_OPPONENT, gBattlerPartyIndexes[GetBattlerAtPosition(B_POSITION_OPPONENT_LEFT)]);
                 break;
             case B_TXT_PLAYER_MON2_NAME: // second player poke name
-                GetMonData(&gPlayerParty[gBattlerPartyIndexes[GetBattlerAtPosition(B_POSITION_PLAYER_RIGHT)]],
-                           MON_DATA_NICKNAME, text);
-                StringGet_Nickname(text);
-                toCpy = text;
+                toCpy = GetBattleNickname(B_SIDE_PLAYER, gBattlerPartyIndexes[GetBattlerAtPosition(B_POSITION_PLAYER_RIGHT)]);
                 break;
             case B_TXT_OPPONENT_MON2_NAME: // second enemy poke name
-                GetMonData(&gEnemyParty[gBattlerPartyIndexes[GetBattlerAtPosition(B_POSITION_OPPONENT_RIGHT)]],
-                           MON_DATA_NICKNAME, text);
-                StringGet_Nickname(text);
-                toCpy = text;
+                toCpy = GetBattleNickname(B_SIDE_OPPONENT, gBattlerPartyIndexes[GetBattlerAtPosition(B_POSITION_OPPONENT_RIGHT)]);
                 break;
             case B_TXT_LINK_PLAYER_MON1_NAME: // link first player poke name
-                GetMonData(&gPlayerParty[gBattlerPartyIndexes[gLinkPlayers[multiplayerId].id]],
-                           MON_DATA_NICKNAME, text);
-                StringGet_Nickname(text);
-                toCpy = text;
+                toCpy = GetBattleNickname(B_SIDE_PLAYER, gBattlerPartyIndexes[gLinkPlayers[multiplayerId].id]);
                 break;
             case B_TXT_LINK_OPPONENT_MON1_NAME: // link first opponent poke name
-                GetMonData(&gEnemyParty[gBattlerPartyIndexes[gLinkPlayers[multiplayerId].id ^ 1]],
-                           MON_DATA_NICKNAME, text);
-                StringGet_Nickname(text);
-                toCpy = text;
+                toCpy = GetBattleNickname(B_SIDE_OPPONENT, gBattlerPartyIndexes[gLinkPlayers[multiplayerId].id ^ 1]);
                 break;
             case B_TXT_LINK_PLAYER_MON2_NAME: // link second player poke name
-                GetMonData(&gPlayerParty[gBattlerPartyIndexes[gLinkPlayers[multiplayerId].id ^ 2]],
-                           MON_DATA_NICKNAME, text);
-                StringGet_Nickname(text);
-                toCpy = text;
+                toCpy = GetBattleNickname(B_SIDE_PLAYER, gBattlerPartyIndexes[gLinkPlayers[multiplayerId].id ^ 2]);
                 break;
             case B_TXT_LINK_OPPONENT_MON2_NAME: // link second opponent poke name
-                GetMonData(&gEnemyParty[gBattlerPartyIndexes[gLinkPlayers[multiplayerId].id ^ 3]],
-                           MON_DATA_NICKNAME, text);
-                StringGet_Nickname(text);
-                toCpy = text;
+                toCpy = GetBattleNickname(B_SIDE_OPPONENT, gBattlerPartyIndexes[gLinkPlayers[multiplayerId].id ^ 3]);
                 break;
             case B_TXT_ATK_NAME_WITH_PREFIX_MON1: // attacker name with prefix, only battler 0/1
                 HANDLE_NICKNAME_STRING_CASE(gBattlerAttacker,
                                             gBattlerPartyIndexes[GetBattlerAtPosition(GET_BATTLER_SIDE(gBattlerAttacker))])
                 break;
             case B_TXT_ATK_PARTNER_NAME: // attacker partner name
-                if (GetBattlerSide(gBattlerAttacker) == B_SIDE_PLAYER)
-                    GetMonData(&gPlayerParty[gBattlerPartyIndexes[GetBattlerAtPosition(GET_BATTLER_SIDE(gBattlerAttacker)) + 2]], MON_DATA_NICKNAME, text);
-                else
-                    GetMonData(&gEnemyParty[gBattlerPartyIndexes[GetBattlerAtPosition(GET_BATTLER_SIDE(gBattlerAttacker)) + 2]], MON_DATA_NICKNAME, text);
-
-                StringGet_Nickname(text);
-                toCpy = text;
+                toCpy = GetBattleNickname(GetBattlerSide(gBattlerAttacker),
+                                          gBattlerPartyIndexes[GetBattlerAtPosition(GET_BATTLER_SIDE(gBattlerAttacker)) + 2]);
                 break;
             case B_TXT_ATK_NAME_WITH_PREFIX: // attacker name with prefix
                 HANDLE_NICKNAME_STRING_CASE(gBattlerAttacker, gBattlerPartyIndexes[gBattlerAttacker])
@@ -2732,12 +2701,7 @@ u32 BattleStringExpandPlaceholders(const u8 *src, u8 *dst)
             }
 
             // missing if (toCpy != NULL) check
-            while (*toCpy != EOS)
-            {
-                dst[dstID] = *toCpy;
-                dstID++;
-                toCpy++;
-            }
+            dstID = StringCopy(&dst[dstID], toCpy) - dst;
             if (*src == B_TXT_TRAINER1_LOSE_TEXT || *src == B_TXT_TRAINER2_LOSE_TEXT
                 || *src == B_TXT_TRAINER1_WIN_TEXT || *src == B_TXT_TRAINER2_WIN_TEXT)
             {
@@ -2749,8 +2713,14 @@ u32 BattleStringExpandPlaceholders(const u8 *src, u8 *dst)
         }
         else
         {
-            dst[dstID] = *src;
-            dstID++;
+            // Copy the literal text up to the next placeholder in one run.
+            do
+            {
+                dst[dstID] = *src;
+                dstID++;
+                src++;
+            } while (*src != PLACEHOLDER_BEGIN && *src != EOS);
+            continue;
         }
         src++;
     }
@@ -2761,6 +2731,29 @@ u32 BattleStringExpandPlaceholders(const u8 *src, u8 *dst)
     return dstID;
 }
 
+static const u8 *GetBattleNickname(u32 side, u32 partyId)
+{
+    u8 *nickname = sNicknameCache[side][partyId];
+    u16 flag = 1 << (side * PARTY_SIZE + partyId);
+
+    if (!(sNicknameCacheFlags & flag))
+    {
+        if (side == B_SIDE_PLAYER)
+            GetMonData(&gPlayerParty[partyId], MON_DATA_NICKNAME, nickname);
+        else
+            GetMonData(&gEnemyParty[partyId], MON_DATA_NICKNAME, nickname);
+        StringGet_Nickname(nickname);
+        sNicknameCacheFlags |= flag;
+    }
+
+    return nickname;
+}
+
+void ClearBattleNicknameCache(void)
+{
+    sNicknameCacheFlags = 0;
+}
+
 static void ExpandBattleTextBuffPlaceholders(const u8 *src, u8 *dst)
 {
     u32 srcID = 1;
@@ -60,6 +60,15 @@ struct PyramidFloorTemplate
     u8 layoutOffsets[NUM_LAYOUT_OFFSETS];
 };
 
+// Everything about a floor that follows from pyramidRandoms and the floor number.
+struct PyramidFloorLayout
+{
+    u8 templateId;
+    u8 entranceSquareId;
+    u8 exitSquareId;
+    u8 layoutOffsets[NUM_PYRAMID_FLOOR_SQUARES];
+};
+
 struct PyramidTrainerEncounterMusic
 {
     u8 trainerClass;
@@ -90,13 +99,13 @@ static u8 GetPyramidFloorTemplateId(void);
 static u8 GetPostBattleDirectionHintTextIndex(int *, u8, u8);
 static void Task_SetPyramidFloorPalette(u8);
 static void MarkPyramidTrainerAsBattled(u16);
+static void GetPyramidFloorLayout(struct PyramidFloorLayout *);
 static void GetPyramidFloorLayoutOffsets(u8 *);
 static void GetPyramidEntranceAndExitSquareIds(u8 *, u8 *);
-static void SetPyramidObjectPositionsUniformly(u8);
-static bool8 SetPyramidObjectPositionsInAndNearSquare(u8, u8);
-static bool8 SetPyramidObjectPositionsNearSquare(u8, u8);
-static bool8 TrySetPyramidObjectEventPositionInSquare(u8, u8 *, u8, u8);
-static bool8 TrySetPyramidObjectEventPositionAtCoords(bool8, u8, u8, u8 *, u8, u8);
+static void SetPyramidObjectPositionsUniformly(u8, const struct PyramidFloorLayout *);
+static bool8 SetPyramidObjectPositionsInAndNearSquare(u8, u8, const struct PyramidFloorLayout *);
+static bool8 SetPyramidObjectPositionsNearSquare(u8, u8, const struct PyramidFloorLayout *);
+static bool8 TrySetPyramidObjectEventPositionInSquare(u8, const u8 *, u8, u8);
 
 // Const rom data.
 #define ABILITY_RANDOM 2 // For wild mons data.
@@ -963,10 +972,7 @@ static void GiveBattlePyramidPrize(void)
 
 static void SeedPyramidFloor(void)
 {
-    int i;
-
-    for (i = 0; i < (int)ARRAY_COUNT(gSaveBlock2Ptr->frontier.pyramidRandoms); i++)
-        gSaveBlock2Ptr->frontier.pyramidRandoms[i] = Random();
+    RandomFill(gSaveBlock2Ptr->frontier.pyramidRandoms, ARRAY_COUNT(gSaveBlock2Ptr->frontier.pyramidRandoms));
 
     gSaveBlock2Ptr->frontier.pyramidTrainerFlags = 0;
 }
@@ -1523,36 +1529,44 @@ void GenerateBattlePyramidFloorLayout(u16 *backupMapData, bool8 setPlayerPositio
 {
     int y, x;
     int i;
-    u8 entranceSquareId, exitSquareId;
-    u8 *floorLayoutOffsets = AllocZeroed(NUM_PYRAMID_FLOOR_SQUARES);
+    int mapWidth;
+    struct PyramidFloorLayout floorLayout;
+    const struct MapLayout *mapLayout;
+
+    GetPyramidFloorLayout(&floorLayout);
+
+    // All of the squares' layouts have the same dimensions.
+    mapLayout = gMapLayouts[floorLayout.layoutOffsets[0] + LAYOUT_BATTLE_FRONTIER_BATTLE_PYRAMID_FLOOR];
+    mapWidth = mapLayout->width * PYRAMID_FLOOR_SQUARES_WIDE + MAP_OFFSET_W;
+    gBackupMapLayout.map = backupMapData;
+    gBackupMapLayout.width = mapWidth;
+    gBackupMapLayout.height = mapLayout->height * PYRAMID_FLOOR_SQUARES_HIGH + MAP_OFFSET_H;
 
-    GetPyramidFloorLayoutOffsets(floorLayoutOffsets);
-    GetPyramidEntranceAndExitSquareIds(&entranceSquareId, &exitSquareId);
     for (i = 0; i < NUM_PYRAMID_FLOOR_SQUARES; i++)
     {
         u16 *map;
-        int yOffset, xOffset;
-        const struct MapLayout *mapLayout = gMapLayouts[floorLayoutOffsets[i] + LAYOUT_BATTLE_FRONTIER_BATTLE_PYRAMID_FLOOR];
-        const u16 *layoutMap = mapLayout->map;
+        const u16 *layoutMap;
 
-        gBackupMapLayout.map = backupMapData;
-        gBackupMapLayout.width = mapLayout->width * PYRAMID_FLOOR_SQUARES_WIDE + MAP_OFFSET_W;
-        gBackupMapLayout.height = mapLayout->height * PYRAMID_FLOOR_SQUARES_HIGH + MAP_OFFSET_H;
+        mapLayout = gMapLayouts[floorLayout.layoutOffsets[i] + LAYOUT_BATTLE_FRONTIER_BATTLE_PYRAMID_FLOOR];
+        layoutMap = mapLayout->map;
         map = backupMapData;
-        yOffset = ((i / PYRAMID_FLOOR_SQUARES_WIDE * mapLayout->height) + MAP_OFFSET) * gBackupMapLayout.width;
-        xOffset = (i % PYRAMID_FLOOR_SQUARES_WIDE * mapLayout->width) + MAP_OFFSET;
-        map += yOffset + xOffset;
+        map += ((i / PYRAMID_FLOOR_SQUARES_WIDE * mapLayout->height) + MAP_OFFSET) * mapWidth;
+        map += (i % PYRAMID_FLOOR_SQUARES_WIDE * mapLayout->width) + MAP_OFFSET;
         for (y = 0; y < mapLayout->height; y++)
         {
-            for (x = 0; x < mapLayout->width; x++)
+            // Rows are only halfword aligned in the backup map.
+            CpuCopy16(layoutMap, map, mapLayout->width * sizeof(u16));
+
+            // Only the exit square keeps its exit. Every other square's exit becomes floor,
+            // and the entrance square's exit is where the player starts.
+            if (i != floorLayout.exitSquareId)
             {
-                if ((layoutMap[x] & MAPGRID_METATILE_ID_MASK) != METATILE_BattlePyramid_Exit)
-                {
-                    map[x] = layoutMap[x];
-                }
-                else if (i != exitSquareId)
+                for (x = 0; x < mapLayout->width; x++)
                 {
-                    if (i == entranceSquareId && setPlayerPosition == FALSE)
+                    if ((layoutMap[x] & MAPGRID_METATILE_ID_MASK) != METATILE_BattlePyramid_Exit)
+                        continue;
+
+                    if (i == floorLayout.entranceSquareId && setPlayerPosition == FALSE)
                     {
                         gSaveBlock1Ptr->pos.x = (mapLayout->width * (i % PYRAMID_FLOOR_SQUARES_WIDE)) + x;
                         gSaveBlock1Ptr->pos.y = (mapLayout->height * (i / PYRAMID_FLOOR_SQUARES_WIDE)) + y;
@@ -1560,30 +1574,25 @@ void GenerateBattlePyramidFloorLayout(u16 *backupMapData, bool8 setPlayerPositio
                     // Copy the elevation and collision, but overwrite the metatile ID
                     map[x] = (layoutMap[x] & (MAPGRID_ELEVATION_MASK | MAPGRID_COLLISION_MASK)) | METATILE_BattlePyramid_Floor;
                 }
-                else
-                {
-                    map[x] = layoutMap[x];
-                }
             }
-            map += MAP_OFFSET_W + (mapLayout->width * PYRAMID_FLOOR_SQUARES_WIDE);
+            map += mapWidth;
             layoutMap += mapLayout->width;
         }
     }
     RunOnLoadMapScript();
-    Free(floorLayoutOffsets);
 }
 
 void LoadBattlePyramidObjectEventTemplates(void)
 {
     int i;
     u8 id;
-    u8 entranceSquareId, exitSquareId;
+    struct PyramidFloorLayout floorLayout;
 
     for (i = 0; i < MAX_PYRAMID_TRAINERS; i++)
         gSaveBlock2Ptr->frontier.trainerIds[i] = 0xFFFF;
 
-    id = GetPyramidFloorTemplateId();
-    GetPyramidEntranceAndExitSquareIds(&entranceSquareId, &exitSquareId);
+    GetPyramidFloorLayout(&floorLayout);
+    id = floorLayout.templateId;
     CpuFill32(0, gSaveBlock1Ptr->objectEventTemplates, sizeof(gSaveBlock1Ptr->objectEventTemplates));
     for (i = 0; i < 2; i++)
     {
@@ -1597,23 +1606,23 @@ void LoadBattlePyramidObjectEventTemplates(void)
         switch (objectPositionsType)
         {
         case OBJ_POSITIONS_UNIFORM:
-            SetPyramidObjectPositionsUniformly(i);
+            SetPyramidObjectPositionsUniformly(i, &floorLayout);
             break;
         case OBJ_POSITIONS_IN_AND_NEAR_ENTRANCE:
-            if (SetPyramidObjectPositionsInAndNearSquare(i, entranceSquareId))
-                SetPyramidObjectPositionsUniformly(i);
+            if (SetPyramidObjectPositionsInAndNearSquare(i, floorLayout.entranceSquareId, &floorLayout))
+                SetPyramidObjectPositionsUniformly(i, &floorLayout);
             break;
         case OBJ_POSITIONS_IN_AND_NEAR_EXIT:
-            if (SetPyramidObjectPositionsInAndNearSquare(i, exitSquareId))
-                SetPyramidObjectPositionsUniformly(i);
+            if (SetPyramidObjectPositionsInAndNearSquare(i, floorLayout.exitSquareId, &floorLayout))
+                SetPyramidObjectPositionsUniformly(i, &floorLayout);
             break;
         case OBJ_POSITIONS_NEAR_ENTRANCE:
-            if (SetPyramidObjectPositionsNearSquare(i, entranceSquareId))
-                SetPyramidObjectPositionsUniformly(i);
+            if (SetPyramidObjectPositionsNearSquare(i, floorLayout.entranceSquareId, &floorLayout))
+                SetPyramidObjectPositionsUniformly(i, &floorLayout);
             break;
         case OBJ_POSITIONS_NEAR_EXIT:
-            if (SetPyramidObjectPositionsNearSquare(i, exitSquareId))
-                SetPyramidObjectPositionsUniformly(i);
+            if (SetPyramidObjectPositionsNearSquare(i, floorLayout.exitSquareId, &floorLayout))
+                SetPyramidObjectPositionsUniformly(i, &floorLayout);
             break;
         }
     }
@@ -1645,17 +1654,15 @@ static void GetPyramidEntranceAndExitSquareIds(u8 *entranceSquareId, u8 *exitSqu
     }
 }
 
-static void SetPyramidObjectPositionsUniformly(u8 objType)
+static void SetPyramidObjectPositionsUniformly(u8 objType, const struct PyramidFloorLayout *floorLayout)
 {
     int i;
     int numObjects;
     int objectStartIndex;
     int squareId;
     u32 bits = 0;
-    u8 id = GetPyramidFloorTemplateId();
-    u8 *floorLayoutOffsets = AllocZeroed(NUM_PYRAMID_FLOOR_SQUARES);
+    u8 id = floorLayout->templateId;
 
-    GetPyramidFloorLayoutOffsets(floorLayoutOffsets);
     squareId = gSaveBlock2Ptr->frontier.pyramidRandoms[2] % NUM_PYRAMID_FLOOR_SQUARES;
     if (objType == OBJ_TRAINERS)
     {
@@ -1696,13 +1703,12 @@ static void SetPyramidObjectPositionsUniformly(u8 objType)
                 }
             } while (!(bits & 2));
 
-        } while (!(bits & 4) && TrySetPyramidObjectEventPositionInSquare(objType, floorLayoutOffsets, squareId, objectStartIndex + i));
+        } while (!(bits & 4) && TrySetPyramidObjectEventPositionInSquare(objType, floorLayout->layoutOffsets, squareId, objectStartIndex + i));
         bits &= 1;
     }
-    Free(floorLayoutOffsets);
 }
 
-static bool8 SetPyramidObjectPositionsInAndNearSquare(u8 objType, u8 squareId)
+static bool8 SetPyramidObjectPositionsInAndNearSquare(u8 objType, u8 squareId, const struct PyramidFloorLayout *floorLayout)
 {
     int i;
     int objectStartIndex;
@@ -1710,10 +1716,8 @@ static bool8 SetPyramidObjectPositionsInAndNearSquare(u8 objType, u8 squareId)
     int r7 = 0;
     int numPlacedObjects = 0;
     int numObjects;
-    u8 id = GetPyramidFloorTemplateId();
-    u8 *floorLayoutOffsets = AllocZeroed(NUM_PYRAMID_FLOOR_SQUARES);
+    u8 id = floorLayout->templateId;
 
-    GetPyramidFloorLayoutOffsets(floorLayoutOffsets);
     if (objType == OBJ_TRAINERS)
     {
         numObjects = sPyramidFloorTemplates[id].numTrainers;
@@ -1729,14 +1733,14 @@ static bool8 SetPyramidObjectPositionsInAndNearSquare(u8 objType, u8 squareId)
     {
         if (r7 == 0)
         {
-            if (TrySetPyramidObjectEventPositionInSquare(objType, floorLayoutOffsets, squareId, objectStartIndex + i))
+            if (TrySetPyramidObjectEventPositionInSquare(objType, floorLayout->layoutOffsets, squareId, objectStartIndex + i))
                 r7 = 1;
             else
                 numPlacedObjects++;
         }
         if (r7 & 1)
         {
-            if (TrySetPyramidObjectEventPositionInSquare(objType, floorLayoutOffsets, sBorderedSquareIds[squareId][borderedIndex], objectStartIndex + i))
+            if (TrySetPyramidObjectEventPositionInSquare(objType, floorLayout->layoutOffsets, sBorderedSquareIds[squareId][borderedIndex], objectStartIndex + i))
             {
                 do
                 {
@@ -1744,7 +1748,7 @@ static bool8 SetPyramidObjectPositionsInAndNearSquare(u8 objType, u8 squareId)
                     if (sBorderedSquareIds[squareId][borderedIndex] == 0xFF || borderedIndex >= 4)
                         borderedIndex = 0;
                     r7 += 2;
-                } while (r7 >> 1 != 4 && TrySetPyramidObjectEventPositionInSquare(objType, floorLayoutOffsets, sBorderedSquareIds[squareId][borderedIndex], objectStartIndex + i));
+                } while (r7 >> 1 != 4 && TrySetPyramidObjectEventPositionInSquare(objType, floorLayout->layoutOffsets, sBorderedSquareIds[squareId][borderedIndex], objectStartIndex + i));
                 numPlacedObjects++;
             }
             else
@@ -1761,14 +1765,10 @@ static bool8 SetPyramidObjectPositionsInAndNearSquare(u8 objType, u8 squareId)
 
         r7 &= 1;
     }
-    #ifdef BUGFIX
-    Free(floorLayoutOffsets);
-    #endif
-
     return (numObjects / 2) > numPlacedObjects;
 }
 
-static bool8 SetPyramidObjectPositionsNearSquare(u8 objType, u8 squareId)
+static bool8 SetPyramidObjectPositionsNearSquare(u8 objType, u8 squareId, const struct PyramidFloorLayout *floorLayout)
 {
     int i;
     int objectStartIndex;
@@ -1776,10 +1776,8 @@ static bool8 SetPyramidObjectPositionsNearSquare(u8 objType, u8 squareId)
     int numPlacedObjects = 0;
     int r8 = 0;
     int numObjects;
-    u8 id = GetPyramidFloorTemplateId();
-    u8 *floorLayoutOffsets = AllocZeroed(NUM_PYRAMID_FLOOR_SQUARES);
+    u8 id = floorLayout->templateId;
 
-    GetPyramidFloorLayoutOffsets(floorLayoutOffsets);
     if (objType == OBJ_TRAINERS)
     {
         numObjects = sPyramidFloorTemplates[id].numTrainers;
@@ -1793,7 +1791,7 @@ static bool8 SetPyramidObjectPositionsNearSquare(u8 objType, u8 squareId)
 
     for (i = 0; i < numObjects; i++)
     {
-        if (TrySetPyramidObjectEventPositionInSquare(objType, floorLayoutOffsets, sBorderedSquareIds[squareId][borderOffset], objectStartIndex + i))
+        if (TrySetPyramidObjectEventPositionInSquare(objType, floorLayout->layoutOffsets, sBorderedSquareIds[squareId][borderOffset], objectStartIndex + i))
         {
             do
             {
@@ -1801,7 +1799,7 @@ static bool8 SetPyramidObjectPositionsNearSquare(u8 objType, u8 squareId)
                 if (sBorderedSquareIds[squareId][borderOffset] == 0xFF || borderOffset >= 4)
                     borderOffset = 0;
                 r8++;
-            } while (r8 != 4 && TrySetPyramidObjectEventPositionInSquare(objType, floorLayoutOffsets, sBorderedSquareIds[squareId][borderOffset], objectStartIndex + i));
+            } while (r8 != 4 && TrySetPyramidObjectEventPositionInSquare(objType, floorLayout->layoutOffsets, sBorderedSquareIds[squareId][borderOffset], objectStartIndex + i));
             numPlacedObjects++;
         }
         else
@@ -1815,85 +1813,79 @@ static bool8 SetPyramidObjectPositionsNearSquare(u8 objType, u8 squareId)
         if (r8 == 4)
             break;
     }
-    #ifdef BUGFIX
-    Free(floorLayoutOffsets);
-    #endif
-
     return (numObjects / 2) > numPlacedObjects;
 }
 
-static bool8 TrySetPyramidObjectEventPositionInSquare(u8 objType, u8 *floorLayoutOffsets, u8 squareId, u8 objectEventId)
-{
-    int x, y;
-
-    if (gSaveBlock2Ptr->frontier.pyramidRandoms[0] & 1)
-    {
-        for (y = 7; y > -1; y--)
-        {
-            for (x = 7; x > -1; x--)
-            {
-                if (!TrySetPyramidObjectEventPositionAtCoords(objType, x, y, floorLayoutOffsets, squareId, objectEventId))
-                    return FALSE;
-            }
-        }
-    }
-    else
-    {
-        for (y = 0; y < 8; y++)
-        {
-            for (x = 0; x < 8; x++)
-            {
-                if (!TrySetPyramidObjectEventPositionAtCoords(objType, x, y, floorLayoutOffsets, squareId, objectEventId))
-                    return FALSE;
-            }
-        }
-    }
-
-    return TRUE;
-}
-
-static bool8 TrySetPyramidObjectEventPositionAtCoords(u8 objType, u8 x, u8 y, u8 *floorLayoutOffsets, u8 squareId, u8 objectEventId)
+// Places the object at the first free position in the square that has an object of the
+// right type in the square's map, scanning the square's 8x8 grid forwards or backwards.
+// Returns FALSE if the object was placed.
+static bool8 TrySetPyramidObjectEventPositionInSquare(u8 objType, const u8 *floorLayoutOffsets, u8 squareId, u8 objectEventId)
 {
     int i, j;
+    int bestId = -1;
+    int bestPos = 0;
+    bool32 reverse = gSaveBlock2Ptr->frontier.pyramidRandoms[0] & 1;
+    u8 squareX = (squareId % PYRAMID_FLOOR_SQUARES_WIDE) * 8;
+    u8 squareY = (squareId / PYRAMID_FLOOR_SQUARES_WIDE) * 8;
     const struct MapHeader *mapHeader;
     struct ObjectEventTemplate *floorEvents = gSaveBlock1Ptr->objectEventTemplates;
 
     mapHeader = Overworld_GetMapHeaderByGroupAndId(MAP_GROUP(MAP_BATTLE_PYRAMID_SQUARE01), floorLayoutOffsets[squareId] + MAP_NUM(MAP_BATTLE_PYRAMID_SQUARE01));
     for (i = 0; i < mapHeader->events->objectEventCount; i++)
     {
-        if (mapHeader->events->objectEvents[i].x != x || mapHeader->events->objectEvents[i].y != y)
+        const struct ObjectEventTemplate *event = &mapHeader->events->objectEvents[i];
+        int pos;
+
+        if ((u16)event->x >= 8 || (u16)event->y >= 8)
             continue;
 
-        if (objType != OBJ_TRAINERS || mapHeader->events->objectEvents[i].graphicsId == OBJ_EVENT_GFX_ITEM_BALL)
-        {
-            if (objType != OBJ_ITEMS || mapHeader->events->objectEvents[i].graphicsId != OBJ_EVENT_GFX_ITEM_BALL)
-                continue;
-        }
+        if ((objType == OBJ_TRAINERS) == (event->graphicsId == OBJ_EVENT_GFX_ITEM_BALL))
+            continue;
+
+        // Scanning backwards visits the positions in the opposite order.
+        pos = event->y * 8 + event->x;
+        if (reverse)
+            pos = 63 - pos;
+
+        // Keep the first object at the earliest position.
+        if (bestId != -1 && pos >= bestPos)
+            continue;
 
         // Ensure an object wasn't previously placed in the exact same position.
         for (j = 0; j < objectEventId; j++)
         {
-            if (floorEvents[j].x == x + ((squareId % 4) * 8) && floorEvents[j].y == y + ((squareId / 4) * 8))
+            if (floorEvents[j].x == event->x + squareX && floorEvents[j].y == event->y + squareY)
                 break;
         }
 
         if (j == objectEventId)
         {
-            floorEvents[objectEventId] = mapHeader->events->objectEvents[i];
-            floorEvents[objectEventId].x += (squareId % 4) * 8;
-            floorEvents[objectEventId].y += (squareId / 4) * 8;
-            floorEvents[objectEventId].localId = objectEventId + 1;
-            if (floorEvents[objectEventId].graphicsId != OBJ_EVENT_GFX_ITEM_BALL)
-            {
-                i = GetUniqueTrainerId(objectEventId);
-                floorEvents[objectEventId].graphicsId = GetBattleFacilityTrainerGfxId(i);
-                gSaveBlock2Ptr->frontier.trainerIds[objectEventId] = i;
-            }
-            return FALSE;
+            bestId = i;
+            bestPos = pos;
         }
     }
 
-    return TRUE;
+    if (bestId == -1)
+        return TRUE;
+
+    floorEvents[objectEventId] = mapHeader->events->objectEvents[bestId];
+    floorEvents[objectEventId].x += squareX;
+    floorEvents[objectEventId].y += squareY;
+    floorEvents[objectEventId].localId = objectEventId + 1;
+    if (floorEvents[objectEventId].graphicsId != OBJ_EVENT_GFX_ITEM_BALL)
+    {
+        i = GetUniqueTrainerId(objectEventId);
+        floorEvents[objectEventId].graphicsId = GetBattleFacilityTrainerGfxId(i);
+        gSaveBlock2Ptr->frontier.trainerIds[objectEventId] = i;
+    }
+    return FALSE;
+}
+
+static void GetPyramidFloorLayout(struct PyramidFloorLayout *floorLayout)
+{
+    floorLayout->templateId = GetPyramidFloorTemplateId();
+    GetPyramidEntranceAndExitSquareIds(&floorLayout->entranceSquareId, &floorLayout->exitSquareId);
+    GetPyramidFloorLayoutOffsets(floorLayout->layoutOffsets);
 }
 
 static void GetPyramidFloorLayoutOffsets(u8 *layoutOffsets)
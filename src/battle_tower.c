@@ -23,6 +23,7 @@
 #include "field_message_box.h"
 #include "tv.h"
 #include "battle_factory.h"
+#include "frontier_party.h"
 #include "constants/apprentice.h"
 #include "constants/battle_dome.h"
 #include "constants/battle_frontier.h"
@@ -79,73 +80,7 @@ static void FillPartnerParty(u16 trainerId);
 static void SetEReaderTrainerChecksum(struct BattleTowerEReaderTrainer *ereaderTrainer);
 static u8 SetTentPtrsGetLevel(void);
 
-const u16 gBattleFrontierHeldItems[] =
-{
-    [BATTLE_FRONTIER_ITEM_NONE]           = ITEM_NONE,
-    [BATTLE_FRONTIER_ITEM_KINGS_ROCK]     = ITEM_KINGS_ROCK,
-    [BATTLE_FRONTIER_ITEM_SITRUS_BERRY]   = ITEM_SITRUS_BERRY,
-    [BATTLE_FRONTIER_ITEM_ORAN_BERRY]     = ITEM_ORAN_BERRY,
-    [BATTLE_FRONTIER_ITEM_CHESTO_BERRY]   = ITEM_CHESTO_BERRY,
-    [BATTLE_FRONTIER_ITEM_HARD_STONE]     = ITEM_HARD_STONE,
-    [BATTLE_FRONTIER_ITEM_FOCUS_BAND]     = ITEM_FOCUS_BAND,
-    [BATTLE_FRONTIER_ITEM_PERSIM_BERRY]   = ITEM_PERSIM_BERRY,
-    [BATTLE_FRONTIER_ITEM_MIRACLE_SEED]   = ITEM_MIRACLE_SEED,
-    [BATTLE_FRONTIER_ITEM_BERRY_JUICE]    = ITEM_BERRY_JUICE,
-    [BATTLE_FRONTIER_ITEM_MACHO_BRACE]    = ITEM_MACHO_BRACE,
-    [BATTLE_FRONTIER_ITEM_SILVER_POWDER]  = ITEM_SILVER_POWDER,
-    [BATTLE_FRONTIER_ITEM_CHERI_BERRY]    = ITEM_CHERI_BERRY,
-    [BATTLE_FRONTIER_ITEM_BLACK_GLASSES]  = ITEM_BLACK_GLASSES,
-    [BATTLE_FRONTIER_ITEM_BLACK_BELT]     = ITEM_BLACK_BELT,
-    [BATTLE_FRONTIER_ITEM_SOUL_DEW]       = ITEM_SOUL_DEW,
-    [BATTLE_FRONTIER_ITEM_CHOICE_BAND]    = ITEM_CHOICE_BAND,
-    [BATTLE_FRONTIER_ITEM_MAGNET]         = ITEM_MAGNET,
-    [BATTLE_FRONTIER_ITEM_SILK_SCARF]     = ITEM_SILK_SCARF,
-    [BATTLE_FRONTIER_ITEM_WHITE_HERB]     = ITEM_WHITE_HERB,
-    [BATTLE_FRONTIER_ITEM_DEEP_SEA_SCALE] = ITEM_DEEP_SEA_SCALE,
-    [BATTLE_FRONTIER_ITEM_DEEP_SEA_TOOTH] = ITEM_DEEP_SEA_TOOTH,
-    [BATTLE_FRONTIER_ITEM_MYSTIC_WATER]   = ITEM_MYSTIC_WATER,
-    [BATTLE_FRONTIER_ITEM_SHARP_BEAK]     = ITEM_SHARP_BEAK,
-    [BATTLE_FRONTIER_ITEM_QUICK_CLAW]     = ITEM_QUICK_CLAW,
-    [BATTLE_FRONTIER_ITEM_LEFTOVERS]      = ITEM_LEFTOVERS,
-    [BATTLE_FRONTIER_ITEM_RAWST_BERRY]    = ITEM_RAWST_BERRY,
-    [BATTLE_FRONTIER_ITEM_LIGHT_BALL]     = ITEM_LIGHT_BALL,
-    [BATTLE_FRONTIER_ITEM_POISON_BARB]    = ITEM_POISON_BARB,
-    [BATTLE_FRONTIER_ITEM_NEVER_MELT_ICE] = ITEM_NEVER_MELT_ICE,
-    [BATTLE_FRONTIER_ITEM_ASPEAR_BERRY]   = ITEM_ASPEAR_BERRY,
-    [BATTLE_FRONTIER_ITEM_SPELL_TAG]      = ITEM_SPELL_TAG,
-    [BATTLE_FRONTIER_ITEM_BRIGHT_POWDER]  = ITEM_BRIGHT_POWDER,
-    [BATTLE_FRONTIER_ITEM_LEPPA_BERRY]    = ITEM_LEPPA_BERRY,
-    [BATTLE_FRONTIER_ITEM_SCOPE_LENS]     = ITEM_SCOPE_LENS,
-    [BATTLE_FRONTIER_ITEM_TWISTED_SPOON]  = ITEM_TWISTED_SPOON,
-    [BATTLE_FRONTIER_ITEM_METAL_COAT]     = ITEM_METAL_COAT,
-    [BATTLE_FRONTIER_ITEM_MENTAL_HERB]    = ITEM_MENTAL_HERB,
-    [BATTLE_FRONTIER_ITEM_CHARCOAL]       = ITEM_CHARCOAL,
-    [BATTLE_FRONTIER_ITEM_PECHA_BERRY]    = ITEM_PECHA_BERRY,
-    [BATTLE_FRONTIER_ITEM_SOFT_SAND]      = ITEM_SOFT_SAND,
-    [BATTLE_FRONTIER_ITEM_LUM_BERRY]      = ITEM_LUM_BERRY,
-    [BATTLE_FRONTIER_ITEM_DRAGON_SCALE]   = ITEM_DRAGON_SCALE,
-    [BATTLE_FRONTIER_ITEM_DRAGON_FANG]    = ITEM_DRAGON_FANG,
-    [BATTLE_FRONTIER_ITEM_IAPAPA_BERRY]   = ITEM_IAPAPA_BERRY,
-    [BATTLE_FRONTIER_ITEM_WIKI_BERRY]     = ITEM_WIKI_BERRY,
-    [BATTLE_FRONTIER_ITEM_SEA_INCENSE]    = ITEM_SEA_INCENSE,
-    [BATTLE_FRONTIER_ITEM_SHELL_BELL]     = ITEM_SHELL_BELL,
-    [BATTLE_FRONTIER_ITEM_SALAC_BERRY]    = ITEM_SALAC_BERRY,
-    [BATTLE_FRONTIER_ITEM_LANSAT_BERRY]   = ITEM_LANSAT_BERRY,
-    [BATTLE_FRONTIER_ITEM_APICOT_BERRY]   = ITEM_APICOT_BERRY,
-    [BATTLE_FRONTIER_ITEM_STARF_BERRY]    = ITEM_STARF_BERRY,
-    [BATTLE_FRONTIER_ITEM_LIECHI_BERRY]   = ITEM_LIECHI_BERRY,
-    [BATTLE_FRONTIER_ITEM_STICK]          = ITEM_STICK,
-    [BATTLE_FRONTIER_ITEM_LAX_INCENSE]    = ITEM_LAX_INCENSE,
-    [BATTLE_FRONTIER_ITEM_AGUAV_BERRY]    = ITEM_AGUAV_BERRY,
-    [BATTLE_FRONTIER_ITEM_FIGY_BERRY]     = ITEM_FIGY_BERRY,
-    [BATTLE_FRONTIER_ITEM_THICK_CLUB]     = ITEM_THICK_CLUB,
-    [BATTLE_FRONTIER_ITEM_MAGO_BERRY]     = ITEM_MAGO_BERRY,
-    [BATTLE_FRONTIER_ITEM_METAL_POWDER]   = ITEM_METAL_POWDER,
-    [BATTLE_FRONTIER_ITEM_PETAYA_BERRY]   = ITEM_PETAYA_BERRY,
-    [BATTLE_FRONTIER_ITEM_LUCKY_PUNCH]    = ITEM_LUCKY_PUNCH,
-    [BATTLE_FRONTIER_ITEM_GANLON_BERRY]   = ITEM_GANLON_BERRY,
-};
-
+#include "data/battle_frontier/battle_frontier_held_items.h"
 #include "data/battle_frontier/battle_frontier_trainer_mons.h"
 #include "data/battle_frontier/battle_frontier_trainers.h"
 #include "data/battle_frontier/battle_frontier_mons.h"
@@ -1630,14 +1565,33 @@ static void FillTentTrainerParty(u8 monsCount)
     FillTentTrainerParty_(gTrainerBattleOpponent_A, 0, monsCount);
 }
 
+static void ExcludeEnemyPartyMons(struct FrontierPartyExclusions *exclusions, u8 count)
+{
+    s32 i;
+
+    ClearFrontierPartyExclusions(exclusions);
+    for (i = 0; i < count; i++)
+    {
+        AddFrontierPartyExclusion(exclusions,
+                                  GetMonData(&gEnemyParty[i], MON_DATA_SPECIES, NULL),
+                                  GetMonData(&gEnemyParty[i], MON_DATA_HELD_ITEM, NULL));
+    }
+}
+
 static void FillTrainerParty(u16 trainerId, u8 firstMonId, u8 monCount)
 {
     s32 i, j;
-    u16 chosenMonIndices[MAX_FRONTIER_PARTY_SIZE];
+    struct FrontierPartyExclusions exclusions;
+#ifdef FRONTIER_PARTY_DIRECT_DRAW
+    u8 candidates[UCHAR_MAX]; // monSet has fewer than UCHAR_MAX Pokémon
+    u8 numCandidates;
+#else
+    u8 numRejected;
+    u8 bfMonCount;
+#endif
     u8 friendship = MAX_FRIENDSHIP;
     u8 level = SetFacilityPtrsGetLevel();
     u8 fixedIV = 0;
-    u8 bfMonCount;
     const u16 *monSet = NULL;
     u32 otID = 0;
 
@@ -1682,50 +1636,53 @@ static void FillTrainerParty(u16 trainerId, u8 firstMonId, u8 monCount)
     // Regular battle frontier trainer.
     // Attempt to fill the trainer's party with random Pokémon until 3 have been
     // successfully chosen. The trainer's party may not have duplicate Pokémon species
-    // or duplicate held items.
+    // or duplicate held items, including those of a partner trainer whose party
+    // was already filled.
+    ExcludeEnemyPartyMons(&exclusions, firstMonId);
+#ifdef FRONTIER_PARTY_DIRECT_DRAW
+    // candidates tracks the Pokémon in monSet that may still be chosen.
+    // "High tier" Pokémon are only allowed on open level mode
+    // 20 is not a possible value for level here
+    numCandidates = InitFrontierPartyCandidates(candidates, monSet, level == FRONTIER_MAX_LEVEL_50 || level == 20);
+#else
     for (bfMonCount = 0; monSet[bfMonCount] != 0xFFFF; bfMonCount++)
         ;
+    numRejected = 0;
+#endif
+
     i = 0;
     otID = Random32();
     while (i != monCount)
     {
+#ifdef FRONTIER_PARTY_DIRECT_DRAW
+        // Draw from the Pokémon that haven't been ruled out, removing each one once it's drawn.
+        u16 monId = DrawFrontierPartyCandidate(&exclusions, monSet, candidates, &numCandidates);
+
+        if (monId == 0xFFFF)
+            break;
+#else
+        // Draw from the whole set and reject, which keeps the random number
+        // sequence (and so the generated parties) identical to the original game.
         u16 monId = monSet[Random() % bfMonCount];
 
         // "High tier" Pokémon are only allowed on open level mode
         // 20 is not a possible value for level here
-        if ((level == FRONTIER_MAX_LEVEL_50 || level == 20) && monId > FRONTIER_MONS_HIGH_TIER)
-            continue;
-
-        // Ensure this Pokémon species isn't a duplicate.
-        for (j = 0; j < i + firstMonId; j++)
+        // Also ensure this Pokémon's species and held item aren't duplicates.
+        if (((level == FRONTIER_MAX_LEVEL_50 || level == 20) && monId > FRONTIER_MONS_HIGH_TIER)
+         || IsFrontierMonExcluded(&exclusions, monId))
         {
-            if (GetMonData(&gEnemyParty[j], MON_DATA_SPECIES, NULL) == gFacilityTrainerMons[monId].species)
-                break;
-        }
-        if (j != i + firstMonId)
+            // Stop instead of looping forever if the set has run out.
+            if (++numRejected == bfMonCount)
+            {
+                if (!CanAnyFrontierMonJoinParty(&exclusions, monSet, bfMonCount, level == FRONTIER_MAX_LEVEL_50 || level == 20))
+                    break;
+                numRejected = 0;
+            }
             continue;
-
-        // Ensure this Pokemon's held item isn't a duplicate.
-        for (j = 0; j < i + firstMonId; j++)
-        {
-            if (GetMonData(&gEnemyParty[j], MON_DATA_HELD_ITEM, NULL) != ITEM_NONE
-             && GetMonData(&gEnemyParty[j], MON_DATA_HELD_ITEM, NULL) == gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId])
-                break;
         }
-        if (j != i + firstMonId)
-            continue;
-
-        // Ensure this exact Pokémon index isn't a duplicate. This check doesn't seem necessary
-        // because the species and held items were already checked directly above.
-        for (j = 0; j < i; j++)
-        {
-            if (chosenMonIndices[j] == monId)
-                break;
-        }
-        if (j != i)
-            continue;
+#endif
 
-        chosenMonIndices[i] = monId;
+        AddFrontierPartyExclusion(&exclusions, gFacilityTrainerMons[monId].species, gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId]);
 
         // Place the chosen Pokémon into the trainer's party.
         CreateMonWithEVSpreadNatureOTID(&gEnemyParty[i + firstMonId],
@@ -3382,17 +3339,24 @@ static void SetNextBattleTentOpponent(void)
 static void FillTentTrainerParty_(u16 trainerId, u8 firstMonId, u8 monCount)
 {
     s32 i, j;
-    u16 chosenMonIndices[MAX_FRONTIER_PARTY_SIZE];
+    struct FrontierPartyExclusions exclusions;
+#ifdef FRONTIER_PARTY_DIRECT_DRAW
+    u8 candidates[UCHAR_MAX]; // monSet has fewer than UCHAR_MAX Pokémon
+    u8 numCandidates;
+#else
+    u8 numRejected = 0;
+    u8 bfMonCount;
+    u16 monId;
+#endif
     u8 friendship;
     u8 level = SetTentPtrsGetLevel();
     u8 fixedIV = 0;
-    u8 bfMonCount;
     const u16 *monSet = NULL;
     u32 otID = 0;
-    u16 monId;
 
     monSet = gFacilityTrainers[gTrainerBattleOpponent_A].monSet;
 
+#ifndef FRONTIER_PARTY_DIRECT_DRAW
     bfMonCount = 0;
     monId = monSet[bfMonCount];
     while (monId != 0xFFFF)
@@ -3402,43 +3366,40 @@ static void FillTentTrainerParty_(u16 trainerId, u8 firstMonId, u8 monCount)
         if (monId == 0xFFFF)
             break;
     }
+#endif
+
+    // See FillTrainerParty.
+    ExcludeEnemyPartyMons(&exclusions, firstMonId);
+#ifdef FRONTIER_PARTY_DIRECT_DRAW
+    numCandidates = InitFrontierPartyCandidates(candidates, monSet, FALSE);
+#endif
 
     i = 0;
     otID = Random32();
     while (i != monCount)
     {
-        u16 monId = monSet[Random() % bfMonCount];
+#ifdef FRONTIER_PARTY_DIRECT_DRAW
+        u16 monId = DrawFrontierPartyCandidate(&exclusions, monSet, candidates, &numCandidates);
 
-        // Ensure this Pokémon species isn't a duplicate.
-        for (j = 0; j < i + firstMonId; j++)
-        {
-            if (GetMonData(&gEnemyParty[j], MON_DATA_SPECIES, NULL) == gFacilityTrainerMons[monId].species)
-                break;
-        }
-        if (j != i + firstMonId)
-            continue;
+        if (monId == 0xFFFF)
+            break;
+#else
+        u16 monId = monSet[Random() % bfMonCount];
 
-        // Ensure this Pokemon's held item isn't a duplicate.
-        for (j = 0; j < i + firstMonId; j++)
+        // Ensure this Pokémon's species and held item aren't duplicates.
+        if (IsFrontierMonExcluded(&exclusions, monId))
         {
-            if (GetMonData(&gEnemyParty[j], MON_DATA_HELD_ITEM, NULL) != ITEM_NONE
-             && GetMonData(&gEnemyParty[j], MON_DATA_HELD_ITEM, NULL) == gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId])
-                break;
-        }
-        if (j != i + firstMonId)
+            if (++numRejected == bfMonCount)
+            {
+                if (!CanAnyFrontierMonJoinParty(&exclusions, monSet, bfMonCount, FALSE))
+                    break;
+                numRejected = 0;
+            }
             continue;
-
-        // Ensure this exact Pokémon index isn't a duplicate. This check doesn't seem necessary
-        // because the species and held items were already checked directly above.
-        for (j = 0; j < i; j++)
-        {
-            if (chosenMonIndices[j] == monId)
-                break;
         }
-        if (j != i)
-            continue;
+#endif
 
-        chosenMonIndices[i] = monId;
+        AddFrontierPartyExclusion(&exclusions, gFacilityTrainerMons[monId].species, gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId]);
 
         // Place the chosen Pokémon into the trainer's party.
         CreateMonWithEVSpreadNatureOTID(&gEnemyParty[i + firstMonId],
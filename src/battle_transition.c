@@ -1283,11 +1283,9 @@ static bool8 Shuffle_End(struct Task *task)
     task->tSinVal += 4224;
     task->tAmplitude += 384;
 
-    for (i = 0; i < DISPLAY_HEIGHT; i++, sinVal += 4224)
-    {
-        u16 sinIndex = sinVal / 256;
-        gScanlineEffectRegBuffers[0][i] = sTransitionData->cameraY + Sin(sinIndex, amplitude);
-    }
+    SinBatch((s16 *)gScanlineEffectRegBuffers[0], DISPLAY_HEIGHT, sinVal, 4224, amplitude);
+    for (i = 0; i < DISPLAY_HEIGHT; i++)
+        gScanlineEffectRegBuffers[0][i] += sTransitionData->cameraY;
 
     if (!gPaletteFade.active)
         DestroyTask(FindTaskIdByFunc(Task_Shuffle));
@@ -2114,11 +2112,9 @@ static bool8 Ripple_Main(struct Task *task)
     if (task->tAmplitudeVal <= 0x1FFF)
         task->tAmplitudeVal += 0x180;
 
-    for (i = 0; i < DISPLAY_HEIGHT; i++, sinVal += speed)
-    {
-        s16 sinIndex = sinVal >> 8;
-        gScanlineEffectRegBuffers[0][i] = sTransitionData->cameraY + Sin(sinIndex & 0xffff, amplitude);
-    }
+    SinBatch((s16 *)gScanlineEffectRegBuffers[0], DISPLAY_HEIGHT, sinVal, speed, amplitude);
+    for (i = 0; i < DISPLAY_HEIGHT; i++)
+        gScanlineEffectRegBuffers[0][i] += sTransitionData->cameraY;
 
     if (++task->tTimer == 81)
     {
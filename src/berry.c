@@ -1086,7 +1086,9 @@ void BerryTreeTimeUpdate(s32 minutes)
 
         if (tree->berry && tree->stage && !tree->stopGrowth)
         {
-            if (minutes >= GetStageDurationByBerryType(tree->berry) * 71)
+            s32 stageDuration = GetStageDurationByBerryType(tree->berry);
+
+            if (minutes >= stageDuration * 71)
             {
                 *tree = gBlankBerryTree;
             }
@@ -1096,17 +1098,34 @@ void BerryTreeTimeUpdate(s32 minutes)
 
                 while (time != 0)
                 {
+                    bool32 regrew;
+
                     if (tree->minutesUntilNextStage > time)
                     {
                         tree->minutesUntilNextStage -= time;
                         break;
                     }
                     time -= tree->minutesUntilNextStage;
-                    tree->minutesUntilNextStage = GetStageDurationByBerryType(tree->berry);
+                    tree->minutesUntilNextStage = stageDuration;
+                    regrew = (tree->stage == BERRY_STAGE_BERRIES);
                     if (!BerryTreeGrow(tree))
                         break;
                     if (tree->stage == BERRY_STAGE_BERRIES)
                         tree->minutesUntilNextStage *= 4;
+
+                    // A tree that has just regrown isn't watered, so every full cycle through
+                    // the sprouted, taller, flowering and berries stages (1 + 1 + 1 + 4 stage
+                    // durations) ends in this same state with one more regrowth. Skip them, but
+                    // leave the final regrowth that clears the tree to the loop above.
+                    if (regrew && tree->stage == BERRY_STAGE_SPROUTED)
+                    {
+                        s32 cycles = time / (stageDuration * 7);
+
+                        if (cycles > 9 - tree->regrowthCount)
+                            cycles = 9 - tree->regrowthCount;
+                        tree->regrowthCount += cycles;
+                        time -= cycles * stageDuration * 7;
+                    }
                 }
             }
         }
@@ -25,6 +25,7 @@
 #include "international_string_util.h"
 #include "random.h"
 #include "menu.h"
+#include "minigame_profiler.h"
 #include "pokeblock.h"
 #include "trig.h"
 #include "tv.h"
@@ -1488,11 +1489,18 @@ static void CB2_StartBlenderLink(void)
     }
 
     Blender_DummiedOutFunc(sBerryBlender->bg_X, sBerryBlender->bg_Y);
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_LOGIC);
     RunTasks();
+    MINIGAME_PROF_END(MINIGAME_PROF_LOGIC);
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_SPRITES);
     AnimateSprites();
     BuildOamBuffer();
+    MINIGAME_PROF_END(MINIGAME_PROF_SPRITES);
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_BG);
     RunTextPrinters();
     UpdatePaletteFade();
+    MINIGAME_PROF_END(MINIGAME_PROF_BG);
+    MINIGAME_PROF_END_FRAME("BerryBlender");
 }
 
 static void InitBlenderBgs(void)
@@ -1797,11 +1805,18 @@ static void CB2_StartBlenderLocal(void)
     }
 
     Blender_DummiedOutFunc(sBerryBlender->bg_X, sBerryBlender->bg_Y);
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_LOGIC);
     RunTasks();
+    MINIGAME_PROF_END(MINIGAME_PROF_LOGIC);
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_SPRITES);
     AnimateSprites();
     BuildOamBuffer();
+    MINIGAME_PROF_END(MINIGAME_PROF_SPRITES);
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_BG);
     RunTextPrinters();
     UpdatePaletteFade();
+    MINIGAME_PROF_END(MINIGAME_PROF_BG);
+    MINIGAME_PROF_END_FRAME("BerryBlender");
 }
 
 static void ResetLinkCmds(void)
@@ -2211,18 +2226,26 @@ static void HandlePlayerInput(void)
 
 static void CB2_PlayBlender(void)
 {
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_BG);
     UpdateBlenderCenter();
+    MINIGAME_PROF_END(MINIGAME_PROF_BG);
 
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_LOGIC);
     if (sBerryBlender->gameFrameTime < (99 * 60 * 60) + (59 * 60)) // game time can't be longer than 99 minutes and 59 seconds, can't print 3 digits
         sBerryBlender->gameFrameTime++;
 
     HandlePlayerInput();
     SetLinkDebugValues((u16)(sBerryBlender->speed), sBerryBlender->progressBarValue);
     UpdateOpponentScores();
+    MINIGAME_PROF_END(MINIGAME_PROF_LOGIC);
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_BG);
     TryUpdateProgressBar(sBerryBlender->progressBarValue, MAX_PROGRESS_BAR);
     UpdateRPM(sBerryBlender->speed);
     RestoreBgCoords();
+    MINIGAME_PROF_END(MINIGAME_PROF_BG);
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_LINK);
     ProcessLinkPlayerCmds();
+    MINIGAME_PROF_END(MINIGAME_PROF_LINK);
     if (sBerryBlender->gameEndState == 0 && sBerryBlender->maxProgressBarValue >= MAX_PROGRESS_BAR)
     {
         sBerryBlender->progressBarValue = MAX_PROGRESS_BAR;
@@ -2231,11 +2254,18 @@ static void CB2_PlayBlender(void)
     }
 
     Blender_DummiedOutFunc(sBerryBlender->bg_X, sBerryBlender->bg_Y);
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_LOGIC);
     RunTasks();
+    MINIGAME_PROF_END(MINIGAME_PROF_LOGIC);
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_SPRITES);
     AnimateSprites();
     BuildOamBuffer();
+    MINIGAME_PROF_END(MINIGAME_PROF_SPRITES);
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_BG);
     RunTextPrinters();
     UpdatePaletteFade();
+    MINIGAME_PROF_END(MINIGAME_PROF_BG);
+    MINIGAME_PROF_END_FRAME("BerryBlender");
 }
 
 static void Blender_DummiedOutFunc(s16 bgX, s16 bgY)
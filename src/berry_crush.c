@@ -20,6 +20,7 @@
 #include "overworld.h"
 #include "palette.h"
 #include "minigame_countdown.h"
+#include "minigame_profiler.h"
 #include "random.h"
 #include "digit_obj_util.h"
 #include "save.h"
@@ -1132,10 +1133,17 @@ static void VBlankCB(void)
 
 static void MainCB(void)
 {
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_LOGIC);
     RunTasks();
+    MINIGAME_PROF_END(MINIGAME_PROF_LOGIC);
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_BG);
     RunTextPrinters();
+    MINIGAME_PROF_END(MINIGAME_PROF_BG);
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_SPRITES);
     AnimateSprites();
     BuildOamBuffer();
+    MINIGAME_PROF_END(MINIGAME_PROF_SPRITES);
+    MINIGAME_PROF_END_FRAME("BerryCrush");
 }
 
 static void MainTask(u8 taskId)
@@ -2789,7 +2797,9 @@ static void HandlePlayerInput(struct BerryCrushGame *game)
     game->localState.bigSparkle = game->bigSparkle;
     game->localState.sparkleAmount = game->sparkleAmount;
     memcpy(game->sendCmd, &game->localState, sizeof(game->sendCmd));
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_LINK);
     Rfu_SendPacket(game->sendCmd);
+    MINIGAME_PROF_END(MINIGAME_PROF_LINK);
 }
 
 static void RecvLinkData(struct BerryCrushGame *game)
@@ -2826,7 +2836,9 @@ static u32 Cmd_PlayGame_Leader(struct BerryCrushGame *game, u8 *args)
 {
     memset(&game->localState, 0, sizeof(game->localState));
     memset(&game->recvCmd, 0, sizeof(game->recvCmd));
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_LINK);
     RecvLinkData(game);
+    MINIGAME_PROF_END(MINIGAME_PROF_LINK);
     SetGpuReg(REG_OFFSET_BG0VOFS, -game->vibration);
     SetGpuReg(REG_OFFSET_BG2VOFS, -game->vibration);
     SetGpuReg(REG_OFFSET_BG3VOFS, -game->vibration);
@@ -2859,7 +2871,9 @@ static u32 Cmd_PlayGame_Member(struct BerryCrushGame *game, u8 *args)
 {
     memset(&game->localState, 0, sizeof(game->localState));
     memset(&game->recvCmd, 0, sizeof(game->recvCmd));
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_LINK);
     RecvLinkData(game);
+    MINIGAME_PROF_END(MINIGAME_PROF_LINK);
     SetGpuReg(REG_OFFSET_BG0VOFS, -game->vibration);
     SetGpuReg(REG_OFFSET_BG2VOFS, -game->vibration);
     SetGpuReg(REG_OFFSET_BG3VOFS, -game->vibration);
@@ -29,6 +29,7 @@ static void ClearDaycareMonMail(struct DaycareMail *mail);
 static void SetInitialEggData(struct Pokemon *mon, u16 species, struct DayCare *daycare);
 static u8 GetDaycareCompatibilityScore(struct DayCare *daycare);
 static void DaycarePrintMonInfo(u8 windowId, u32 daycareSlotId, u8 y);
+static void BuildEggLookupTables(void);
 
 // RAM buffers used to assist with BuildEggMoveset()
 EWRAM_DATA static u16 sHatchedEggLevelUpMoves[EGG_LVL_UP_MOVES_ARRAY_COUNT] = {0};
@@ -37,6 +38,12 @@ EWRAM_DATA static u16 sHatchedEggFinalMoves[MAX_MON_MOVES] = {0};
 EWRAM_DATA static u16 sHatchedEggEggMoves[EGG_MOVES_ARRAY_COUNT] = {0};
 EWRAM_DATA static u16 sHatchedEggMotherMoves[MAX_MON_MOVES] = {0};
 
+// Reverse indexes of gEvolutionTable and gEggMoves, built the first time
+// either is needed.
+EWRAM_DATA static u16 sPreEvolutions[NUM_SPECIES] = {0};
+EWRAM_DATA static u16 sEggMovesStart[NUM_SPECIES] = {0};
+EWRAM_DATA static bool8 sEggLookupTablesBuilt = FALSE;
+
 #include "data/pokemon/egg_moves.h"
 
 static const struct WindowTemplate sDaycareLevelMenuWindowTemplate =
@@ -375,37 +382,59 @@ static void UNUSED ClearAllDaycareData(struct DayCare *daycare)
     daycare->stepCounter = 0;
 }
 
+// Fills sPreEvolutions with the species each species evolves from and
+// sEggMovesStart with the index of each species' first egg move in gEggMoves.
+// Species without one are left at 0. gEggMoves[0] is always a species marker,
+// so GetEggMoves finds no moves there.
+static void BuildEggLookupTables(void)
+{
+    u16 i, j;
+
+    if (sEggLookupTablesBuilt)
+        return;
+
+    // Go backwards so that if two species evolve into the same one, the
+    // lowest numbered one is kept, as the old search over gEvolutionTable did.
+    for (i = NUM_SPECIES - 1; i != SPECIES_NONE; i--)
+    {
+        for (j = 0; j < EVOS_PER_MON; j++)
+        {
+            u16 targetSpecies = gEvolutionTable[i][j].targetSpecies;
+            if (targetSpecies != SPECIES_NONE && targetSpecies < NUM_SPECIES)
+                sPreEvolutions[targetSpecies] = i;
+        }
+    }
+
+    for (i = 0; i < ARRAY_COUNT(gEggMoves) - 1; i++)
+    {
+        if (gEggMoves[i] > EGG_MOVES_SPECIES_OFFSET)
+        {
+            u16 species = gEggMoves[i] - EGG_MOVES_SPECIES_OFFSET;
+            if (species < NUM_SPECIES && sEggMovesStart[species] == 0)
+                sEggMovesStart[species] = i + 1;
+        }
+    }
+
+    sEggLookupTablesBuilt = TRUE;
+}
+
 // Determines what the species of an Egg would be based on the given species.
 // It determines this by working backwards through the evolution chain of the
 // given species.
 static u16 GetEggSpecies(u16 species)
 {
-    int i, j, k;
-    bool8 found;
+    int i;
+
+    BuildEggLookupTables();
 
     // Working backwards up to 5 times seems arbitrary, since the maximum number
     // of times would only be 3 for 3-stage evolutions.
     for (i = 0; i < EVOS_PER_MON; i++)
     {
-        found = FALSE;
-        for (j = 1; j < NUM_SPECIES; j++)
-        {
-            for (k = 0; k < EVOS_PER_MON; k++)
-            {
-                if (gEvolutionTable[j][k].targetSpecies == species)
-                {
-                    species = j;
-                    found = TRUE;
-                    break;
-                }
-            }
-
-            if (found)
-                break;
-        }
-
-        if (j == NUM_SPECIES)
+        if (sPreEvolutions[species] == SPECIES_NONE)
             break;
+
+        species = sPreEvolutions[species];
     }
 
     return species;
@@ -606,16 +635,9 @@ static u8 GetEggMoves(struct Pokemon *pokemon, u16 *eggMoves)
     u16 i;
 
     numEggMoves = 0;
-    eggMoveIdx = 0;
     species = GetMonData(pokemon, MON_DATA_SPECIES);
-    for (i = 0; i < ARRAY_COUNT(gEggMoves) - 1; i++)
-    {
-        if (gEggMoves[i] == species + EGG_MOVES_SPECIES_OFFSET)
-        {
-            eggMoveIdx = i + 1;
-            break;
-        }
-    }
+    BuildEggLookupTables();
+    eggMoveIdx = sEggMovesStart[species];
 
     for (i = 0; i < EGG_MOVES_ARRAY_COUNT; i++)
     {
@@ -634,6 +656,7 @@ static void BuildEggMoveset(struct Pokemon *egg, struct BoxPokemon *father, stru
     u16 numSharedParentMoves;
     u32 numLevelUpMoves;
     u16 numEggMoves;
+    u16 eggSpecies;
     u16 i, j;
 
     numSharedParentMoves = 0;
@@ -676,13 +699,15 @@ static void BuildEggMoveset(struct Pokemon *egg, struct BoxPokemon *father, stru
             break;
         }
     }
+    eggSpecies = GetMonData(egg, MON_DATA_SPECIES);
     for (i = 0; i < MAX_MON_MOVES; i++)
     {
         if (sHatchedEggFatherMoves[i] != MOVE_NONE)
         {
-            for (j = 0; j < NUM_TECHNICAL_MACHINES + NUM_HIDDEN_MACHINES; j++)
+            // Only the TMs/HMs the egg can learn are checked
+            for (j = GetNextSpeciesTMHM(eggSpecies, 0); j < NUM_TECHNICAL_MACHINES + NUM_HIDDEN_MACHINES; j = GetNextSpeciesTMHM(eggSpecies, j + 1))
             {
-                if (sHatchedEggFatherMoves[i] == ItemIdToBattleMoveId(ITEM_TM01 + j) && CanMonLearnTMHM(egg, j))
+                if (sHatchedEggFatherMoves[i] == ItemIdToBattleMoveId(ITEM_TM01 + j))
                 {
                     if (GiveMoveToMon(egg, sHatchedEggFatherMoves[i]) == MON_HAS_MAX_MOVES)
                         DeleteFirstMoveAndGiveMoveToMon(egg, sHatchedEggFatherMoves[i]);
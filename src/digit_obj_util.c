@@ -35,6 +35,7 @@ struct DigitPrinterAlloc
 // this file's functions
 static u8 GetFirstOamId(u8 oamCount);
 static void CopyWorkToOam(struct DigitPrinter *objWork);
+static void DrawNumObjs(struct DigitPrinter *objWork, s32 num);
 static void DrawNumObjsLeadingZeros(struct DigitPrinter *objWork, s32 num, bool32 sign);
 static void DrawNumObjsMinusInFront(struct DigitPrinter *objWork, s32 num, bool32 sign);
 static void DrawNumObjsMinusInBack(struct DigitPrinter *objWork, s32 num, bool32 sign);
@@ -170,7 +171,7 @@ bool32 DigitObjUtil_CreatePrinter(u32 id, s32 num, const struct DigitObjUtilTemp
         sOamWork->array[id].pow10 *= 10;
 
     CopyWorkToOam(&sOamWork->array[id]);
-    DigitObjUtil_PrintNumOn(id, num);
+    DrawNumObjs(&sOamWork->array[id], num);
 
     return TRUE;
 }
@@ -202,16 +203,25 @@ static void CopyWorkToOam(struct DigitPrinter *objWork)
     gMain.oamBuffer[oamId].tileNum = objWork->tileStart + (objWork->tilesPerImage * 10);
 }
 
+// Minigames call this every frame for their timers and counters, so the
+// OAM is only rewritten when the number actually changes.
 void DigitObjUtil_PrintNumOn(u32 id, s32 num)
 {
-    bool32 sign;
-
     if (sOamWork == NULL)
         return;
     if (!sOamWork->array[id].isActive)
         return;
+    if (sOamWork->array[id].lastPrinted == num)
+        return;
+
+    DrawNumObjs(&sOamWork->array[id], num);
+}
+
+static void DrawNumObjs(struct DigitPrinter *objWork, s32 num)
+{
+    bool32 sign;
 
-    sOamWork->array[id].lastPrinted = num;
+    objWork->lastPrinted = num;
     if (num < 0)
     {
         sign = TRUE;
@@ -222,17 +232,17 @@ void DigitObjUtil_PrintNumOn(u32 id, s32 num)
         sign = FALSE;
     }
 
-    switch (sOamWork->array[id].strConvMode)
+    switch (objWork->strConvMode)
     {
     case 0:
     default:
-        DrawNumObjsLeadingZeros(&sOamWork->array[id], num, sign);
+        DrawNumObjsLeadingZeros(objWork, num, sign);
         break;
     case 1:
-        DrawNumObjsMinusInFront(&sOamWork->array[id], num, sign);
+        DrawNumObjsMinusInFront(objWork, num, sign);
         break;
     case 2:
-        DrawNumObjsMinusInBack(&sOamWork->array[id], num, sign);
+        DrawNumObjsMinusInBack(objWork, num, sign);
         break;
     }
 }
@@ -384,7 +394,7 @@ void DigitObjUtil_HideOrShow(u32 id, bool32 hide)
         for (i = 0; i < oamCount; i++, oamId++)
             gMain.oamBuffer[oamId].affineMode = ST_OAM_AFFINE_OFF;
 
-        DigitObjUtil_PrintNumOn(id, sOamWork->array[id].lastPrinted);
+        DrawNumObjs(&sOamWork->array[id], sOamWork->array[id].lastPrinted);
     }
 }
 
@@ -22,6 +22,10 @@ static struct Dma3Request sDma3Requests[MAX_DMA_REQUESTS];
 static vbool8 sDma3ManagerLocked;
 static u8 sDma3RequestCursor;
 
+#ifdef BATTLE_ANIM_PROFILER
+u32 gDma3BytesTransferred;
+#endif
+
 void ClearDma3Requests(void)
 {
     int i;
@@ -82,6 +86,10 @@ void ProcessDma3Requests(void)
             break;
         }
 
+#ifdef BATTLE_ANIM_PROFILER
+        gDma3BytesTransferred += sDma3Requests[sDma3RequestCursor].size;
+#endif
+
         // Free the request
         sDma3Requests[sDma3RequestCursor].src = NULL;
         sDma3Requests[sDma3RequestCursor].dest = NULL;
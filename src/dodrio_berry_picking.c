@@ -12,6 +12,7 @@
 #include "m4a.h"
 #include "palette.h"
 #include "minigame_countdown.h"
+#include "minigame_profiler.h"
 #include "random.h"
 #include "save.h"
 #include "script.h"
@@ -818,22 +819,30 @@ static void Task_StartDodrioGame(u8 taskId)
 
 static void Task_DodrioGame_Leader(u8 taskId)
 {
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_LINK);
     RecvLinkData_Leader();
+    MINIGAME_PROF_END(MINIGAME_PROF_LINK);
     sLeaderFuncs[sGame->funcId]();
     if (!sExitingGame)
         UpdateGame_Leader();
 
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_LINK);
     SendLinkData_Leader();
+    MINIGAME_PROF_END(MINIGAME_PROF_LINK);
 }
 
 static void Task_DodrioGame_Member(u8 taskId)
 {
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_LINK);
     RecvLinkData_Member();
+    MINIGAME_PROF_END(MINIGAME_PROF_LINK);
     sMemberFuncs[sGame->funcId]();
     if (!sExitingGame)
         UpdateGame_Member();
 
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_LINK);
     SendLinkData_Member();
+    MINIGAME_PROF_END(MINIGAME_PROF_LINK);
 }
 
 static void DoGameIntro(void)
@@ -1788,10 +1797,17 @@ static void HandleSound_Member(void)
 
 static void CB2_DodrioGame(void)
 {
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_LOGIC);
     RunTasks();
+    MINIGAME_PROF_END(MINIGAME_PROF_LOGIC);
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_SPRITES);
     AnimateSprites();
     BuildOamBuffer();
+    MINIGAME_PROF_END(MINIGAME_PROF_SPRITES);
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_BG);
     UpdatePaletteFade();
+    MINIGAME_PROF_END(MINIGAME_PROF_BG);
+    MINIGAME_PROF_END_FRAME("DodrioBerryPicking");
 }
 
 static void VBlankCB_DodrioGame(void)
@@ -215,6 +215,7 @@ static bool8 EasyChatIsNationalPokedexEnabled(void);
 static u16 GetRandomUnlockedEasyChatPokemon(void);
 static void SetUnlockedEasyChatGroups(void);
 static void SetUnlockedWordsByAlphabet(void);
+static void SetUnlockedEasyChatWords(void);
 static u8 *CopyEasyChatWordPadded(u8 *, u16, u16);
 static u8 IsEasyChatWordUnlocked(u16);
 static u16 SetSelectedWordGroup_GroupMode(u16);
@@ -5601,6 +5602,7 @@ static bool8 InitEasyChatScreenWordData(void)
         return FALSE;
 
     SetUnlockedEasyChatGroups();
+    SetUnlockedEasyChatWords();
     SetUnlockedWordsByAlphabet();
     return TRUE;
 }
@@ -5634,6 +5636,38 @@ static void SetUnlockedEasyChatGroups(void)
 
     if (IsNationalPokedexEnabled())
         sWordData->unlockedGroupIds[sWordData->numUnlockedGroups++] = EC_GROUP_POKEMON_NATIONAL;
+
+    sWordData->unlockedGroups = 0;
+    for (i = 0; i < sWordData->numUnlockedGroups; i++)
+        sWordData->unlockedGroups |= 1 << sWordData->unlockedGroupIds[i];
+}
+
+#define IS_WORD_INDEX_UNLOCKED(groupId, index) (sWordData->unlockedWords[groupId][(index) / 32] & (1 << ((index) % 32)))
+
+// Checks every word once, so that building the alphabetical lists and opening
+// a group only have to test a bit for each word instead of checking flags and
+// the Pokédex again.
+static void SetUnlockedEasyChatWords(void)
+{
+    u32 i, groupId, index;
+    const u16 *list;
+
+    memset(sWordData->unlockedWords, 0, sizeof(sWordData->unlockedWords));
+    for (groupId = 0; groupId < EC_NUM_GROUPS; groupId++)
+    {
+        if (groupId == EC_GROUP_POKEMON || groupId == EC_GROUP_POKEMON_NATIONAL
+         || groupId == EC_GROUP_MOVE_1  || groupId == EC_GROUP_MOVE_2)
+            list = gEasyChatGroups[groupId].wordData.valueList;
+        else
+            list = NULL;
+
+        for (i = 0; i < gEasyChatGroups[groupId].numWords; i++)
+        {
+            index = (list != NULL) ? list[i] : i;
+            if (IsEasyChatIndexAndGroupUnlocked(index, groupId))
+                sWordData->unlockedWords[groupId][index / 32] |= 1 << (index % 32);
+        }
+    }
 }
 
 static u8 GetNumUnlockedEasyChatGroups(void)
@@ -5760,7 +5794,7 @@ static u16 SetSelectedWordGroup_GroupMode(u16 groupId)
         list = gEasyChatGroups[groupId].wordData.valueList;
         for (i = 0, totalWords = 0; i < numWords; i++)
         {
-            if (IsEasyChatIndexAndGroupUnlocked(list[i], groupId))
+            if (IS_WORD_INDEX_UNLOCKED(groupId, list[i]))
                 sWordData->selectedGroupWords[totalWords++] = EC_WORD(groupId, list[i]);
         }
 
@@ -5772,7 +5806,7 @@ static u16 SetSelectedWordGroup_GroupMode(u16 groupId)
         for (i = 0, totalWords = 0; i < numWords; i++)
         {
             u16 alphabeticalOrder = wordInfo[i].alphabeticalOrder;
-            if (IsEasyChatIndexAndGroupUnlocked(alphabeticalOrder, groupId))
+            if (IS_WORD_INDEX_UNLOCKED(groupId, alphabeticalOrder))
                 sWordData->selectedGroupWords[totalWords++] = EC_WORD(groupId, alphabeticalOrder);
         }
 
@@ -5793,14 +5827,7 @@ static u16 SetSelectedWordGroup_AlphabetMode(u16 groupId)
 
 static bool8 IsEasyChatGroupUnlocked2(u8 groupId)
 {
-    int i;
-    for (i = 0; i < sWordData->numUnlockedGroups; i++)
-    {
-        if (sWordData->unlockedGroupIds[i] == groupId)
-            return TRUE;
-    }
-
-    return FALSE;
+    return (sWordData->unlockedGroups & (1 << groupId)) != 0;
 }
 
 static bool8 IsEasyChatIndexAndGroupUnlocked(u16 wordIndex, u8 groupId)
@@ -5844,7 +5871,7 @@ static u8 IsEasyChatWordUnlocked(u16 easyChatWord)
     if (!IsEasyChatGroupUnlocked2(groupId))
         return FALSE;
     else
-        return IsEasyChatIndexAndGroupUnlocked(index, groupId);
+        return IS_WORD_INDEX_UNLOCKED(groupId, index) != 0;
 }
 
 void InitializeEasyChatWordArray(u16 *words, u16 length)
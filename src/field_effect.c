@@ -1371,6 +1371,7 @@ static void Task_UseFly(u8 taskId)
     {
         Overworld_ResetStateAfterFly();
         WarpIntoMap();
+        SetKeepMapTilesetsInVram(TRUE);
         SetMainCallback2(CB2_LoadMap);
         gFieldCallback = FieldCallback_FlyIntoMap;
         DestroyTask(taskId);
@@ -1679,6 +1680,7 @@ static void WarpAtEndOfEscalator(void)
     {
         StopEscalator();
         WarpIntoMap();
+        SetKeepMapTilesetsInVram(TRUE);
         gFieldCallback = FieldCallback_EscalatorWarpIn;
         SetMainCallback2(CB2_LoadMap);
         DestroyTask(FindTaskIdByFunc(Task_EscalatorWarpOut));
@@ -2052,6 +2054,7 @@ static bool8 LavaridgeGymB1FWarpEffect_Warp(struct Task *task, struct ObjectEven
     if (!gPaletteFade.active && BGMusicStopped() == TRUE)
     {
         WarpIntoMap();
+        SetKeepMapTilesetsInVram(TRUE);
         gFieldCallback = FieldCB_LavaridgeGymB1FWarpExit;
         SetMainCallback2(CB2_LoadMap);
         DestroyTask(FindTaskIdByFunc(Task_LavaridgeGymB1FWarp));
@@ -2209,6 +2212,7 @@ static bool8 LavaridgeGym1FWarpEffect_Warp(struct Task *task, struct ObjectEvent
     if (!gPaletteFade.active && BGMusicStopped() == TRUE)
     {
         WarpIntoMap();
+        SetKeepMapTilesetsInVram(TRUE);
         gFieldCallback = FieldCB_FallWarpExit;
         SetMainCallback2(CB2_LoadMap);
         DestroyTask(FindTaskIdByFunc(Task_LavaridgeGym1FWarp));
@@ -2275,6 +2279,7 @@ static void EscapeRopeWarpOutEffect_Spin(struct Task *task)
             SetObjectEventDirection(objectEvent, task->tStartDir);
             SetWarpDestinationToEscapeWarp();
             WarpIntoMap();
+            SetKeepMapTilesetsInVram(TRUE);
             gFieldCallback = FieldCallback_EscapeRopeWarpIn;
             SetMainCallback2(CB2_LoadMap);
             DestroyTask(FindTaskIdByFunc(Task_EscapeRopeWarpOut));
@@ -2441,6 +2446,7 @@ static void TeleportWarpOutFieldEffect_End(struct Task *task)
         {
             SetWarpDestinationToLastHealLocation();
             WarpIntoMap();
+            SetKeepMapTilesetsInVram(TRUE);
             SetMainCallback2(CB2_LoadMap);
             gFieldCallback = FieldCallback_TeleportWarpIn;
             DestroyTask(FindTaskIdByFunc(Task_TeleportWarpOut));
@@ -668,6 +668,9 @@ static void Task_WarpAndLoadMap(u8 taskId)
         break;
     case 2:
         WarpIntoMap();
+        // Nothing has touched the field's VRAM since the warp started, so
+        // the map load can keep any tilesets the new map shares.
+        SetKeepMapTilesetsInVram(TRUE);
         SetMainCallback2(CB2_LoadMap);
         DestroyTask(taskId);
         break;
@@ -1044,6 +1047,7 @@ static void Task_SpinExitWarp(u8 taskId)
         break;
     case 3:
         WarpIntoMap();
+        SetKeepMapTilesetsInVram(TRUE);
         SetMainCallback2(CB2_LoadMap);
         DestroyTask(taskId);
         break;
@@ -24,8 +24,17 @@ enum
     COLOR_MAP_NONE,
     COLOR_MAP_DARK_CONTRAST,
     COLOR_MAP_CONTRAST,
+    // Only used as keys for sMappedPalettes.
+    COLOR_MAP_DROUGHT,
+    COLOR_MAP_FOG,
 };
 
+#define MAPPED_PAL_KEY(colorMapIndex, colorMapType) (((colorMapIndex) & 0x1F) | ((colorMapType) << 5))
+
+// BlendWeatherColors is ARM code that runs from this IWRAM buffer.
+#define BlendWeatherColors_IWRAM(src, dest, numColors, coeff, blendColor) \
+    ((void (*)(const u16 *, u16 *, u32, u32))sBlendWeatherColors_Buffer)(src, dest, numColors, (blendColor) | ((coeff) << 16))
+
 struct RGBColor
 {
     u16 r:5;
@@ -33,6 +42,17 @@ struct RGBColor
     u16 b:5;
 };
 
+// Each palette with its current color map already applied. Fading only has
+// to blend these, and a palette is only remapped when its colors, its color
+// map or its dirty bit changed.
+struct MappedPalettes
+{
+    u16 colors[32][16];
+    u32 sources[32][PLTT_SIZE_4BPP / 4];
+    u8 keys[32];
+    u32 dirty;
+};
+
 struct WeatherCallbacks
 {
     void (*initVars)(void);
@@ -49,6 +69,7 @@ static void ApplyColorMap(u8 startPalIndex, u8 numPalettes, s8 colorMapIndex);
 static void ApplyColorMapWithBlend(u8 startPalIndex, u8 numPalettes, s8 colorMapIndex, u8 blendCoeff, u16 blendColor);
 static void ApplyDroughtColorMapWithBlend(s8 colorMapIndex, u8 blendCoeff, u16 blendColor);
 static void ApplyFogBlend(u8 blendCoeff, u16 blendColor);
+static const u16 *GetMappedPalette(u8 palIndex, u8 colorMapIndex, u8 colorMapType);
 static bool8 FadeInScreen_RainShowShade(void);
 static bool8 FadeInScreen_Drought(void);
 static bool8 FadeInScreen_FogHorizontal(void);
@@ -62,6 +83,11 @@ static u8 None_Finish(void);
 
 EWRAM_DATA struct Weather gWeather = {0};
 EWRAM_DATA static u8 ALIGNED(2) sFieldEffectPaletteColorMapTypes[32] = {0};
+EWRAM_DATA static struct MappedPalettes ALIGNED(4) sMappedPalettes = {0};
+
+static u32 sBlendWeatherColors_Buffer[0x30];
+
+extern void BlendWeatherColors(const u16 *src, u16 *dest, u32 numColors, u32 blend);
 
 static const u8 *sPaletteColorMapTypes;
 
@@ -156,6 +182,7 @@ void StartWeather(void)
     if (!FuncIsActiveTask(Task_WeatherMain))
     {
         u8 index = AllocSpritePalette(PALTAG_WEATHER);
+        CpuCopy32((void *)BlendWeatherColors, sBlendWeatherColors_Buffer, sizeof(sBlendWeatherColors_Buffer));
         CpuCopy32(gFogPalette, &gPlttBufferUnfaded[OBJ_PLTT_ID(index)], PLTT_SIZE_4BPP);
         BuildColorMaps();
         gWeatherPtr->contrastColorMapSpritePalIndex = index;
@@ -280,6 +307,7 @@ static void BuildColorMaps(void)
     s16 diff;
 
     sPaletteColorMapTypes = sBasePaletteColorMapTypes;
+    sMappedPalettes.dirty = 0xFFFFFFFF;
     for (i = 0; i < 2; i++)
     {
         if (i == 0)
@@ -460,8 +488,7 @@ static void ApplyColorMap(u8 startPalIndex, u8 numPalettes, s8 colorMapIndex)
 {
     u16 curPalIndex;
     u16 palOffset;
-    u8 *colorMap;
-    u16 i;
+    u8 colorMapType;
 
     if (colorMapIndex > 0)
     {
@@ -481,22 +508,13 @@ static void ApplyColorMap(u8 startPalIndex, u8 numPalettes, s8 colorMapIndex)
             }
             else
             {
-                u8 r, g, b;
-
                 if (sPaletteColorMapTypes[curPalIndex] == COLOR_MAP_CONTRAST || curPalIndex - 16 == gWeatherPtr->contrastColorMapSpritePalIndex)
-                    colorMap = gWeatherPtr->contrastColorMaps[colorMapIndex];
+                    colorMapType = COLOR_MAP_CONTRAST;
                 else
-                    colorMap = gWeatherPtr->darkenedContrastColorMaps[colorMapIndex];
+                    colorMapType = COLOR_MAP_DARK_CONTRAST;
 
-                for (i = 0; i < 16; i++)
-                {
-                    // Apply color map to the original color.
-                    struct RGBColor baseColor = *(struct RGBColor *)&gPlttBufferUnfaded[palOffset];
-                    r = colorMap[baseColor.r];
-                    g = colorMap[baseColor.g];
-                    b = colorMap[baseColor.b];
-                    gPlttBufferFaded[palOffset++] = RGB2(r, g, b);
-                }
+                CpuFastCopy(GetMappedPalette(curPalIndex, colorMapIndex, colorMapType), &gPlttBufferFaded[palOffset], PLTT_SIZE_4BPP);
+                palOffset += 16;
             }
 
             curPalIndex++;
@@ -520,11 +538,8 @@ static void ApplyColorMap(u8 startPalIndex, u8 numPalettes, s8 colorMapIndex)
             }
             else
             {
-                for (i = 0; i < 16; i++)
-                {
-                    gPlttBufferFaded[palOffset] = sDroughtWeatherColors[colorMapIndex][DROUGHT_COLOR_INDEX(gPlttBufferUnfaded[palOffset])];
-                    palOffset++;
-                }
+                CpuFastCopy(GetMappedPalette(curPalIndex, colorMapIndex, COLOR_MAP_DROUGHT), &gPlttBufferFaded[palOffset], PLTT_SIZE_4BPP);
+                palOffset += 16;
             }
 
             curPalIndex++;
@@ -541,11 +556,7 @@ static void ApplyColorMapWithBlend(u8 startPalIndex, u8 numPalettes, s8 colorMap
 {
     u16 palOffset;
     u16 curPalIndex;
-    u16 i;
-    struct RGBColor color = *(struct RGBColor *)&blendColor;
-    u8 rBlend = color.r;
-    u8 gBlend = color.g;
-    u8 bBlend = color.b;
+    const u16 *src;
 
     palOffset = PLTT_ID(startPalIndex);
     numPalettes += startPalIndex;
@@ -554,140 +565,124 @@ static void ApplyColorMapWithBlend(u8 startPalIndex, u8 numPalettes, s8 colorMap
 
     while (curPalIndex < numPalettes)
     {
+        // Palettes without a color map are simply blended.
         if (sPaletteColorMapTypes[curPalIndex] == COLOR_MAP_NONE)
-        {
-            // No color map. Simply blend the colors.
-            BlendPalette(palOffset, 16, blendCoeff, blendColor);
-            palOffset += 16;
-        }
+            src = &gPlttBufferUnfaded[palOffset];
+        else if (sPaletteColorMapTypes[curPalIndex] == COLOR_MAP_DARK_CONTRAST)
+            src = GetMappedPalette(curPalIndex, colorMapIndex, COLOR_MAP_DARK_CONTRAST);
         else
-        {
-            u8 *colorMap;
-
-            if (sPaletteColorMapTypes[curPalIndex] == COLOR_MAP_DARK_CONTRAST)
-                colorMap = gWeatherPtr->darkenedContrastColorMaps[colorMapIndex];
-            else
-                colorMap = gWeatherPtr->contrastColorMaps[colorMapIndex];
-
-            for (i = 0; i < 16; i++)
-            {
-                struct RGBColor baseColor = *(struct RGBColor *)&gPlttBufferUnfaded[palOffset];
-                u8 r = colorMap[baseColor.r];
-                u8 g = colorMap[baseColor.g];
-                u8 b = colorMap[baseColor.b];
-
-                // Apply color map and target blend color to the original color.
-                r += ((rBlend - r) * blendCoeff) >> 4;
-                g += ((gBlend - g) * blendCoeff) >> 4;
-                b += ((bBlend - b) * blendCoeff) >> 4;
-                gPlttBufferFaded[palOffset++] = RGB2(r, g, b);
-            }
-        }
+            src = GetMappedPalette(curPalIndex, colorMapIndex, COLOR_MAP_CONTRAST);
 
+        BlendWeatherColors_IWRAM(src, &gPlttBufferFaded[palOffset], 16, blendCoeff, blendColor);
+        palOffset += 16;
         curPalIndex++;
     }
 }
 
 static void ApplyDroughtColorMapWithBlend(s8 colorMapIndex, u8 blendCoeff, u16 blendColor)
 {
-    struct RGBColor color;
-    u8 rBlend;
-    u8 gBlend;
-    u8 bBlend;
     u16 curPalIndex;
     u16 palOffset;
-    u16 i;
+    const u16 *src;
 
     colorMapIndex = -colorMapIndex - 1;
-    color = *(struct RGBColor *)&blendColor;
-    rBlend = color.r;
-    gBlend = color.g;
-    bBlend = color.b;
     palOffset = 0;
     for (curPalIndex = 0; curPalIndex < 32; curPalIndex++)
     {
+        // Palettes without a color map are simply blended.
         if (sPaletteColorMapTypes[curPalIndex] == COLOR_MAP_NONE)
-        {
-            // No color map. Simply blend the colors.
-            BlendPalette(palOffset, 16, blendCoeff, blendColor);
-            palOffset += 16;
-        }
+            src = &gPlttBufferUnfaded[palOffset];
         else
-        {
-            for (i = 0; i < 16; i++)
-            {
-                u32 offset;
-                struct RGBColor color1;
-                struct RGBColor color2;
-                u8 r1, g1, b1;
-                u8 r2, g2, b2;
-
-                color1 = *(struct RGBColor *)&gPlttBufferUnfaded[palOffset];
-                r1 = color1.r;
-                g1 = color1.g;
-                b1 = color1.b;
-
-                offset = ((b1 & 0x1E) << 7) | ((g1 & 0x1E) << 3) | ((r1 & 0x1E) >> 1);
-                color2 = *(struct RGBColor *)&sDroughtWeatherColors[colorMapIndex][offset];
-                r2 = color2.r;
-                g2 = color2.g;
-                b2 = color2.b;
-
-                r2 += ((rBlend - r2) * blendCoeff) >> 4;
-                g2 += ((gBlend - g2) * blendCoeff) >> 4;
-                b2 += ((bBlend - b2) * blendCoeff) >> 4;
-
-                gPlttBufferFaded[palOffset++] = RGB2(r2, g2, b2);
-            }
-        }
+            src = GetMappedPalette(curPalIndex, colorMapIndex, COLOR_MAP_DROUGHT);
+
+        BlendWeatherColors_IWRAM(src, &gPlttBufferFaded[palOffset], 16, blendCoeff, blendColor);
+        palOffset += 16;
     }
 }
 
 static void ApplyFogBlend(u8 blendCoeff, u16 blendColor)
 {
-    struct RGBColor color;
-    u8 rBlend;
-    u8 gBlend;
-    u8 bBlend;
     u16 curPalIndex;
+    const u16 *src;
 
-    BlendPalette(BG_PLTT_ID(0), 16 * 16, blendCoeff, blendColor);
-    color = *(struct RGBColor *)&blendColor;
-    rBlend = color.r;
-    gBlend = color.g;
-    bBlend = color.b;
+    BlendWeatherColors_IWRAM(&gPlttBufferUnfaded[BG_PLTT_ID(0)], &gPlttBufferFaded[BG_PLTT_ID(0)], 16 * 16, blendCoeff, blendColor);
 
     for (curPalIndex = 16; curPalIndex < 32; curPalIndex++)
     {
         if (LightenSpritePaletteInFog(curPalIndex))
-        {
-            u16 palEnd = PLTT_ID(curPalIndex + 1);
-            u16 palOffset = PLTT_ID(curPalIndex);
+            src = GetMappedPalette(curPalIndex, 0, COLOR_MAP_FOG);
+        else
+            src = &gPlttBufferUnfaded[PLTT_ID(curPalIndex)];
 
-            while (palOffset < palEnd)
-            {
-                struct RGBColor color = *(struct RGBColor *)&gPlttBufferUnfaded[palOffset];
-                u8 r = color.r;
-                u8 g = color.g;
-                u8 b = color.b;
+        BlendWeatherColors_IWRAM(src, &gPlttBufferFaded[PLTT_ID(curPalIndex)], 16, blendCoeff, blendColor);
+    }
+}
 
-                r += ((28 - r) * 3) >> 2;
-                g += ((31 - g) * 3) >> 2;
-                b += ((28 - b) * 3) >> 2;
+// Returns the given palette with a color map applied. The result is kept in
+// sMappedPalettes and only rebuilt when the unfaded palette or the requested
+// color map differ from the last call, or when the palette is marked dirty.
+static const u16 *GetMappedPalette(u8 palIndex, u8 colorMapIndex, u8 colorMapType)
+{
+    const u16 *src = &gPlttBufferUnfaded[PLTT_ID(palIndex)];
+    u16 *dest = sMappedPalettes.colors[palIndex];
+    u8 key = MAPPED_PAL_KEY(colorMapIndex, colorMapType);
+    const u8 *colorMap;
+    u16 i;
 
-                r += ((rBlend - r) * blendCoeff) >> 4;
-                g += ((gBlend - g) * blendCoeff) >> 4;
-                b += ((bBlend - b) * blendCoeff) >> 4;
+    if (!(sMappedPalettes.dirty & (1 << palIndex)) && sMappedPalettes.keys[palIndex] == key)
+    {
+        const u32 *curr = (const u32 *)src;
 
-                gPlttBufferFaded[palOffset] = RGB2(r, g, b);
-                palOffset++;
-            }
+        for (i = 0; i < PLTT_SIZE_4BPP / 4; i++)
+        {
+            if (curr[i] != sMappedPalettes.sources[palIndex][i])
+                break;
         }
+        if (i == PLTT_SIZE_4BPP / 4)
+            return dest;
+    }
+
+    sMappedPalettes.dirty &= ~(1 << palIndex);
+    sMappedPalettes.keys[palIndex] = key;
+    CpuFastCopy(src, sMappedPalettes.sources[palIndex], PLTT_SIZE_4BPP);
+
+    switch (colorMapType)
+    {
+    case COLOR_MAP_DARK_CONTRAST:
+    case COLOR_MAP_CONTRAST:
+        if (colorMapType == COLOR_MAP_CONTRAST)
+            colorMap = gWeatherPtr->contrastColorMaps[colorMapIndex];
         else
+            colorMap = gWeatherPtr->darkenedContrastColorMaps[colorMapIndex];
+
+        for (i = 0; i < 16; i++)
         {
-            BlendPalette(PLTT_ID(curPalIndex), 16, blendCoeff, blendColor);
+            struct RGBColor baseColor = *(struct RGBColor *)&src[i];
+            dest[i] = RGB2(colorMap[baseColor.r], colorMap[baseColor.g], colorMap[baseColor.b]);
         }
+        break;
+    case COLOR_MAP_DROUGHT:
+        for (i = 0; i < 16; i++)
+            dest[i] = sDroughtWeatherColors[colorMapIndex][DROUGHT_COLOR_INDEX(src[i])];
+        break;
+    case COLOR_MAP_FOG:
+        // Lightens the palette towards RGB(28, 31, 28).
+        for (i = 0; i < 16; i++)
+        {
+            struct RGBColor color = *(struct RGBColor *)&src[i];
+            u8 r = color.r;
+            u8 g = color.g;
+            u8 b = color.b;
+
+            r += ((28 - r) * 3) >> 2;
+            g += ((31 - g) * 3) >> 2;
+            b += ((28 - b) * 3) >> 2;
+            dest[i] = RGB2(r, g, b);
+        }
+        break;
     }
+
+    return dest;
 }
 
 static void MarkFogSpritePalToLighten(u8 paletteIndex)
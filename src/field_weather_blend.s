@@ -0,0 +1,47 @@
+	.include "asm/macros.inc"
+
+	.syntax unified
+
+	.text
+
+@ Blends numColors colors from src towards a color and writes them to dest.
+@ Each channel becomes c + (((target - c) * coeff) >> 4), like BlendPalette.
+@ This is copied to IWRAM by StartWeather and called from there.
+@ r0 = src, r1 = dest, r2 = numColors, r3 = blendColor | (coeff << 16)
+	arm_func_start BlendWeatherColors
+BlendWeatherColors:
+	stmfd sp!, {r4-r9, lr}
+	mov r4, r3, lsr #16
+	and r5, r3, #0x1F
+	mov r6, r3, lsr #5
+	and r6, r6, #0x1F
+	mov r7, r3, lsr #10
+	and r7, r7, #0x1F
+BlendWeatherColors_Loop:
+	subs r2, r2, #1
+	bmi BlendWeatherColors_Done
+	ldrh r8, [r0], #2
+	and r9, r8, #0x1F
+	sub r12, r5, r9
+	mul r12, r4, r12
+	add r9, r9, r12, asr #4
+	mov lr, r8, lsr #5
+	and lr, lr, #0x1F
+	sub r12, r6, lr
+	mul r12, r4, r12
+	add lr, lr, r12, asr #4
+	orr r9, r9, lr, lsl #5
+	mov lr, r8, lsr #10
+	and lr, lr, #0x1F
+	sub r12, r7, lr
+	mul r12, r4, r12
+	add lr, lr, r12, asr #4
+	orr r9, r9, lr, lsl #10
+	strh r9, [r1], #2
+	b BlendWeatherColors_Loop
+BlendWeatherColors_Done:
+	ldmfd sp!, {r4-r9, lr}
+	bx lr
+	arm_func_end BlendWeatherColors
+
+	.align 2, 0 @ Don't pad with nop.
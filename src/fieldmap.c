@@ -29,6 +29,13 @@ EWRAM_DATA static u16 ALIGNED(4) sBackupMapData[MAX_MAP_DATA_SIZE] = {0};
 EWRAM_DATA struct MapHeader gMapHeader = {0};
 EWRAM_DATA struct Camera gCamera = {0};
 EWRAM_DATA static struct ConnectionFlags sMapConnectionFlags = {0};
+// The tilesets last copied to BG VRAM. Every screen outside the overworld
+// reuses that VRAM, so these are only trusted while sKeepTilesetsInVram is
+// set. The overworld warp tasks set it just before they load the new map, and
+// the map load clears it once the tilesets are in place.
+EWRAM_DATA static const struct Tileset *sVramPrimaryTileset = NULL;
+EWRAM_DATA static const struct Tileset *sVramSecondaryTileset = NULL;
+EWRAM_DATA static bool32 sKeepTilesetsInVram = FALSE;
 EWRAM_DATA static u32 UNUSED sFiller = 0; // without this, the next file won't align properly
 
 COMMON_DATA struct BackupMapLayout gBackupMapLayout = {0};
@@ -897,19 +904,41 @@ static void LoadTilesetPalette(struct Tileset const *tileset, u16 destOffset, u1
     }
 }
 
+void SetKeepMapTilesetsInVram(bool32 keep)
+{
+    sKeepTilesetsInVram = keep;
+}
+
+bool32 ShouldKeepMapTilesetsInVram(void)
+{
+    return sKeepTilesetsInVram;
+}
+
+// Skipped when the warp kept VRAM and the tileset is already there. Any
+// animated tiles it left mid-cycle are redrawn by the tileset's animation
+// callback within its first cycle, the same as after a fresh copy.
 void CopyPrimaryTilesetToVram(struct MapLayout const *mapLayout)
 {
+    if (sKeepTilesetsInVram && mapLayout->primaryTileset == sVramPrimaryTileset)
+        return;
+
     CopyTilesetToVram(mapLayout->primaryTileset, NUM_TILES_IN_PRIMARY, 0);
+    sVramPrimaryTileset = mapLayout->primaryTileset;
 }
 
 void CopySecondaryTilesetToVram(struct MapLayout const *mapLayout)
 {
+    if (sKeepTilesetsInVram && mapLayout->secondaryTileset == sVramSecondaryTileset)
+        return;
+
     CopyTilesetToVram(mapLayout->secondaryTileset, NUM_TILES_TOTAL - NUM_TILES_IN_PRIMARY, NUM_TILES_IN_PRIMARY);
+    sVramSecondaryTileset = mapLayout->secondaryTileset;
 }
 
 void CopySecondaryTilesetToVramUsingHeap(struct MapLayout const *mapLayout)
 {
     CopyTilesetToVramUsingHeap(mapLayout->secondaryTileset, NUM_TILES_TOTAL - NUM_TILES_IN_PRIMARY, NUM_TILES_IN_PRIMARY);
+    sVramSecondaryTileset = mapLayout->secondaryTileset;
 }
 
 static void LoadPrimaryTilesetPalette(struct MapLayout const *mapLayout)
@@ -928,6 +957,8 @@ void CopyMapTilesetsToVram(struct MapLayout const *mapLayout)
     {
         CopyTilesetToVramUsingHeap(mapLayout->primaryTileset, NUM_TILES_IN_PRIMARY, 0);
         CopyTilesetToVramUsingHeap(mapLayout->secondaryTileset, NUM_TILES_TOTAL - NUM_TILES_IN_PRIMARY, NUM_TILES_IN_PRIMARY);
+        sVramPrimaryTileset = mapLayout->primaryTileset;
+        sVramSecondaryTileset = mapLayout->secondaryTileset;
     }
 }
 
@@ -0,0 +1,91 @@
+#include "global.h"
+#include "battle_tower.h"
+#include "frontier_party.h"
+#include "random.h"
+#include "constants/battle_frontier_mons.h"
+#include "constants/items.h"
+
+// The checks a randomly generated frontier team goes through, shared by the
+// Battle Tower, Battle Tent and Battle Factory. They read gFacilityTrainerMons,
+// so the facility pointers must already be set.
+
+void ClearFrontierPartyExclusions(struct FrontierPartyExclusions *exclusions)
+{
+    memset(exclusions, 0, sizeof(*exclusions));
+}
+
+void AddFrontierPartyExclusion(struct FrontierPartyExclusions *exclusions, u16 species, u16 heldItem)
+{
+    exclusions->species[species / 32] |= 1 << (species % 32);
+    AddFrontierPartyHeldItemExclusion(exclusions, heldItem);
+}
+
+// For teams that may repeat a species but not a held item.
+void AddFrontierPartyHeldItemExclusion(struct FrontierPartyExclusions *exclusions, u16 heldItem)
+{
+    // Any number of Pokémon may hold no item.
+    if (heldItem != ITEM_NONE)
+        exclusions->heldItems[heldItem / 32] |= 1 << (heldItem % 32);
+}
+
+bool32 IsFrontierMonExcluded(const struct FrontierPartyExclusions *exclusions, u16 monId)
+{
+    u16 species = gFacilityTrainerMons[monId].species;
+    u16 heldItem = gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId];
+
+    if (exclusions->species[species / 32] & (1 << (species % 32)))
+        return TRUE;
+    if (exclusions->heldItems[heldItem / 32] & (1 << (heldItem % 32)))
+        return TRUE;
+    return FALSE;
+}
+
+bool32 CanAnyFrontierMonJoinParty(const struct FrontierPartyExclusions *exclusions, const u16 *monSet, u8 bfMonCount, bool32 highTierBanned)
+{
+    s32 i;
+
+    for (i = 0; i < bfMonCount; i++)
+    {
+        if (highTierBanned && monSet[i] > FRONTIER_MONS_HIGH_TIER)
+            continue;
+        if (!IsFrontierMonExcluded(exclusions, monSet[i]))
+            return TRUE;
+    }
+    return FALSE;
+}
+
+// For FRONTIER_PARTY_DIRECT_DRAW. Fills candidates with the indexes into
+// monSet that DrawFrontierPartyCandidate may pick, and returns how many there
+// are. This goes through monSet once, so its length doesn't need counting first.
+u8 InitFrontierPartyCandidates(u8 *candidates, const u16 *monSet, bool32 highTierBanned)
+{
+    s32 i;
+    u8 numCandidates = 0;
+
+    for (i = 0; monSet[i] != 0xFFFF; i++)
+    {
+        if (highTierBanned && monSet[i] > FRONTIER_MONS_HIGH_TIER)
+            continue;
+        candidates[numCandidates++] = i;
+    }
+    return numCandidates;
+}
+
+// Picks a random candidate that isn't excluded, or returns 0xFFFF if none is
+// left. Every drawn candidate is swapped out of the list: one that's excluded
+// will stay excluded, and the one that's picked excludes itself by species.
+// So a party costs a draw per pick plus one per clashing candidate it runs
+// into, and the list is never filtered as a whole.
+u16 DrawFrontierPartyCandidate(const struct FrontierPartyExclusions *exclusions, const u16 *monSet, u8 *candidates, u8 *numCandidates)
+{
+    while (*numCandidates != 0)
+    {
+        u8 index = Random() % *numCandidates;
+        u16 monId = monSet[candidates[index]];
+
+        candidates[index] = candidates[--(*numCandidates)];
+        if (!IsFrontierMonExcluded(exclusions, monId))
+            return monId;
+    }
+    return 0xFFFF;
+}
@@ -1382,7 +1382,7 @@ static void SpriteCB_HofConfetti(struct Sprite *sprite)
         sprite->y2 += sprite->sExtraY;
 
         sineIdx = sprite->sSineIdx;
-        rand = (Random() % 4) + 8;
+        rand = (CosmeticRandom(RNG_STREAM_UI) % 4) + 8;
         sprite->x2 = rand * gSineTable[sineIdx] / 256;
 
         sprite->sSineIdx += 4;
@@ -1394,16 +1394,16 @@ static bool8 CreateHofConfettiSprite(void)
     u8 spriteID;
     struct Sprite *sprite;
 
-    s16 posX = Random() % DISPLAY_WIDTH;
-    s16 posY = -(Random() % 8);
+    s16 posX = CosmeticRandom(RNG_STREAM_UI) % DISPLAY_WIDTH;
+    s16 posY = -(CosmeticRandom(RNG_STREAM_UI) % 8);
 
     spriteID = CreateSprite(&sSpriteTemplate_HofConfetti, posX, posY, 0);
     sprite = &gSprites[spriteID];
 
-    StartSpriteAnim(sprite, Random() % ARRAY_COUNT(sAnims_Confetti));
+    StartSpriteAnim(sprite, CosmeticRandom(RNG_STREAM_UI) % ARRAY_COUNT(sAnims_Confetti));
 
     // 1/4 confetti sprites move an extra Y coord each frame
-    if (Random() & 3)
+    if (CosmeticRandom(RNG_STREAM_UI) & 3)
         sprite->sExtraY = 0;
     else
         sprite->sExtraY = 1;
@@ -1466,7 +1466,7 @@ static void UpdateDomeConfetti(struct ConfettiUtil *util)
         util->yDelta += util->data[CONFETTI_EXTRA_Y];
 
         sineIdx = util->data[CONFETTI_SINE_IDX];
-        rand = Random();
+        rand = CosmeticRandom(RNG_STREAM_UI);
         rand &= 3;
         rand += 8;
         util->xDelta = (rand) * ((gSineTable[sineIdx])) / 256;
@@ -1501,16 +1501,16 @@ static void Task_DoDomeConfetti(u8 taskId)
             id = ConfettiUtil_AddNew(&sOamData_Confetti,
                               TAG_CONFETTI,
                               TAG_CONFETTI,
-                              Random() % DISPLAY_WIDTH,
-                              -(Random() % 8),
-                              Random() % ARRAY_COUNT(sAnims_Confetti),
+                              CosmeticRandom(RNG_STREAM_UI) % DISPLAY_WIDTH,
+                              -(CosmeticRandom(RNG_STREAM_UI) % 8),
+                              CosmeticRandom(RNG_STREAM_UI) % ARRAY_COUNT(sAnims_Confetti),
                               id);
             if (id != 0xFF)
             {
                 ConfettiUtil_SetCallback(id, UpdateDomeConfetti);
 
                 // 1/4 of the confetti move an extra y coord every frame
-                if ((Random() % 4) == 0)
+                if ((CosmeticRandom(RNG_STREAM_UI) % 4) == 0)
                     ConfettiUtil_SetData(id, CONFETTI_EXTRA_Y, 1);
 
                 ConfettiUtil_SetData(id, CONFETTI_TASK_ID, taskId);
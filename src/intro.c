@@ -1169,7 +1169,7 @@ void CB2_InitCopyrightScreenAfterTitleScreen(void)
 static void Task_Scene1_Load(u8 taskId)
 {
     SetVBlankCallback(NULL);
-    sIntroCharacterGender = MOD(Random(), GENDER_COUNT);
+    sIntroCharacterGender = MOD(CosmeticRandom(RNG_STREAM_UI), GENDER_COUNT);
     IntroResetGpuRegs();
     SetGpuReg(REG_OFFSET_BG3VOFS, 0);
     SetGpuReg(REG_OFFSET_BG2VOFS, 80);
@@ -3116,7 +3116,7 @@ static void SpriteCB_PlayerOnBicycle(struct Sprite *sprite)
     else
     {
         // Random wobble on y axis
-        switch (Random() & 3)
+        switch (CosmeticRandom(RNG_STREAM_UI) & 3)
         {
         case 0:
             sprite->y2 = -1;
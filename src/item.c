@@ -15,6 +15,9 @@
 #include "constants/items.h"
 #include "constants/hold_effects.h"
 
+// The largest bag pocket, used to size scratch space when reordering one.
+#define MAX_BAG_POCKET_CAPACITY max(max(max(BAG_ITEMS_COUNT, BAG_KEYITEMS_COUNT), max(BAG_POKEBALLS_COUNT, BAG_TMHM_COUNT)), BAG_BERRIES_COUNT)
+
 static bool8 CheckPyramidBagHasItem(u16 itemId, u16 count);
 static bool8 CheckPyramidBagHasSpace(u16 itemId, u16 count);
 
@@ -171,22 +174,13 @@ bool8 HasAtLeastOneBerry(void)
     return FALSE;
 }
 
-bool8 CheckBagHasSpace(u16 itemId, u16 count)
+// Whether AddBagItem would be able to fit count of itemId into the pocket.
+static bool8 BagPocketHasSpace(u8 pocket, u16 itemId, u16 count)
 {
     u8 i;
-    u8 pocket;
     u16 slotCapacity;
     u16 ownedCount;
 
-    if (GetItemPocket(itemId) == POCKET_NONE)
-        return FALSE;
-
-    if (CurrentBattlePyramidLocation() != PYRAMID_LOCATION_NONE || FlagGet(FLAG_STORING_ITEMS_IN_PYRAMID_BAG) == TRUE)
-    {
-        return CheckPyramidBagHasSpace(itemId, count);
-    }
-
-    pocket = GetItemPocket(itemId) - 1;
     if (pocket != BERRIES_POCKET)
         slotCapacity = MAX_BAG_ITEM_CAPACITY;
     else
@@ -235,6 +229,19 @@ bool8 CheckBagHasSpace(u16 itemId, u16 count)
     return TRUE;
 }
 
+bool8 CheckBagHasSpace(u16 itemId, u16 count)
+{
+    if (GetItemPocket(itemId) == POCKET_NONE)
+        return FALSE;
+
+    if (CurrentBattlePyramidLocation() != PYRAMID_LOCATION_NONE || FlagGet(FLAG_STORING_ITEMS_IN_PYRAMID_BAG) == TRUE)
+    {
+        return CheckPyramidBagHasSpace(itemId, count);
+    }
+
+    return BagPocketHasSpace(GetItemPocket(itemId) - 1, itemId, count);
+}
+
 bool8 AddBagItem(u16 itemId, u16 count)
 {
     u8 i;
@@ -250,15 +257,17 @@ bool8 AddBagItem(u16 itemId, u16 count)
     else
     {
         struct BagPocket *itemPocket;
-        struct ItemSlot *newItems;
         u16 slotCapacity;
         u16 ownedCount;
         u8 pocket = GetItemPocket(itemId) - 1;
 
-        itemPocket = &gBagPockets[pocket];
-        newItems = AllocZeroed(itemPocket->capacity * sizeof(struct ItemSlot));
-        memcpy(newItems, itemPocket->itemSlots, itemPocket->capacity * sizeof(struct ItemSlot));
+        // Checking for space first walks the slots exactly the way the loops
+        // below fill them, so a failed add leaves the pocket untouched
+        // without having to work on a copy of it.
+        if (!BagPocketHasSpace(pocket, itemId, count))
+            return FALSE;
 
+        itemPocket = &gBagPockets[pocket];
         if (pocket != BERRIES_POCKET)
             slotCapacity = MAX_BAG_ITEM_CAPACITY;
         else
@@ -266,36 +275,24 @@ bool8 AddBagItem(u16 itemId, u16 count)
 
         for (i = 0; i < itemPocket->capacity; i++)
         {
-            if (newItems[i].itemId == itemId)
+            if (itemPocket->itemSlots[i].itemId == itemId)
             {
-                ownedCount = GetBagItemQuantity(&newItems[i].quantity);
+                ownedCount = GetBagItemQuantity(&itemPocket->itemSlots[i].quantity);
                 // check if won't exceed max slot capacity
                 if (ownedCount + count <= slotCapacity)
                 {
                     // successfully added to already existing item's count
-                    SetBagItemQuantity(&newItems[i].quantity, ownedCount + count);
-                    memcpy(itemPocket->itemSlots, newItems, itemPocket->capacity * sizeof(struct ItemSlot));
-                    Free(newItems);
+                    SetBagItemQuantity(&itemPocket->itemSlots[i].quantity, ownedCount + count);
                     return TRUE;
                 }
                 else
                 {
-                    // try creating another instance of the item if possible
-                    if (pocket == TMHM_POCKET || pocket == BERRIES_POCKET)
-                    {
-                        Free(newItems);
-                        return FALSE;
-                    }
-                    else
-                    {
-                        count -= slotCapacity - ownedCount;
-                        SetBagItemQuantity(&newItems[i].quantity, slotCapacity);
-                        // don't create another instance of the item if it's at max slot capacity and count is equal to 0
-                        if (count == 0)
-                        {
-                            break;
-                        }
-                    }
+                    // create another instance of the item
+                    count -= slotCapacity - ownedCount;
+                    SetBagItemQuantity(&itemPocket->itemSlots[i].quantity, slotCapacity);
+                    // don't create another instance of the item if it's at max slot capacity and count is equal to 0
+                    if (count == 0)
+                        break;
                 }
             }
         }
@@ -306,38 +303,24 @@ bool8 AddBagItem(u16 itemId, u16 count)
             // either no existing item was found or we have to create another instance, because the capacity was exceeded
             for (i = 0; i < itemPocket->capacity; i++)
             {
-                if (newItems[i].itemId == ITEM_NONE)
+                if (itemPocket->itemSlots[i].itemId == ITEM_NONE)
                 {
-                    newItems[i].itemId = itemId;
+                    itemPocket->itemSlots[i].itemId = itemId;
                     if (count > slotCapacity)
                     {
-                        // try creating a new slot with max capacity if duplicates are possible
-                        if (pocket == TMHM_POCKET || pocket == BERRIES_POCKET)
-                        {
-                            Free(newItems);
-                            return FALSE;
-                        }
+                        // create a new slot with max capacity
                         count -= slotCapacity;
-                        SetBagItemQuantity(&newItems[i].quantity, slotCapacity);
+                        SetBagItemQuantity(&itemPocket->itemSlots[i].quantity, slotCapacity);
                     }
                     else
                     {
                         // created a new slot and added quantity
-                        SetBagItemQuantity(&newItems[i].quantity, count);
-                        count = 0;
+                        SetBagItemQuantity(&itemPocket->itemSlots[i].quantity, count);
                         break;
                     }
                 }
             }
-
-            if (count > 0)
-            {
-                Free(newItems);
-                return FALSE;
-            }
         }
-        memcpy(itemPocket->itemSlots, newItems, itemPocket->capacity * sizeof(struct ItemSlot));
-        Free(newItems);
         return TRUE;
     }
 }
@@ -598,37 +581,64 @@ static void SwapItemSlots(struct ItemSlot *a, struct ItemSlot *b)
     SWAP(*a, *b, temp);
 }
 
+// Moves the slots that hold items to the front of the pocket in their
+// current order, and returns how many there are. The empty slots are put
+// after them in reverse order, which is where the old pairwise swapping
+// left them.
+static u16 CompactBagPocketSlots(struct BagPocket *bagPocket)
+{
+    struct ItemSlot emptySlots[MAX_BAG_POCKET_CAPACITY];
+    u16 i, count, numEmpty;
+
+    for (i = 0, count = 0, numEmpty = 0; i < bagPocket->capacity; i++)
+    {
+        if (GetBagItemQuantity(&bagPocket->itemSlots[i].quantity) == 0)
+            emptySlots[numEmpty++] = bagPocket->itemSlots[i];
+        else
+            bagPocket->itemSlots[count++] = bagPocket->itemSlots[i];
+    }
+
+    for (i = count; i < bagPocket->capacity; i++)
+        bagPocket->itemSlots[i] = emptySlots[--numEmpty];
+
+    return count;
+}
+
 void CompactItemsInBagPocket(struct BagPocket *bagPocket)
 {
-    u16 i, j;
+    CompactBagPocketSlots(bagPocket);
+}
+
+static void SiftDownItemSlot(struct ItemSlot *itemSlots, u16 root, u16 count)
+{
+    u16 child;
 
-    for (i = 0; i < bagPocket->capacity - 1; i++)
+    while ((child = root * 2 + 1) < count)
     {
-        for (j = i + 1; j < bagPocket->capacity; j++)
-        {
-            if (GetBagItemQuantity(&bagPocket->itemSlots[i].quantity) == 0)
-                SwapItemSlots(&bagPocket->itemSlots[i], &bagPocket->itemSlots[j]);
-        }
+        if (child + 1 < count && itemSlots[child + 1].itemId > itemSlots[child].itemId)
+            child++;
+        if (itemSlots[root].itemId >= itemSlots[child].itemId)
+            return;
+        SwapItemSlots(&itemSlots[root], &itemSlots[child]);
+        root = child;
     }
 }
 
+// Heap sorts the filled slots by item id. A pocket that can be sorted never
+// holds two stacks of the same item, so the sort doesn't need to be stable.
 void SortBerriesOrTMHMs(struct BagPocket *bagPocket)
 {
-    u16 i, j;
+    struct ItemSlot *itemSlots = bagPocket->itemSlots;
+    u16 count = CompactBagPocketSlots(bagPocket);
+    u16 i;
 
-    for (i = 0; i < bagPocket->capacity - 1; i++)
+    for (i = count / 2; i != 0; i--)
+        SiftDownItemSlot(itemSlots, i - 1, count);
+
+    for (i = count; i > 1; i--)
     {
-        for (j = i + 1; j < bagPocket->capacity; j++)
-        {
-            if (GetBagItemQuantity(&bagPocket->itemSlots[i].quantity) != 0)
-            {
-                if (GetBagItemQuantity(&bagPocket->itemSlots[j].quantity) == 0)
-                    continue;
-                if (bagPocket->itemSlots[i].itemId <= bagPocket->itemSlots[j].itemId)
-                    continue;
-            }
-            SwapItemSlots(&bagPocket->itemSlots[i], &bagPocket->itemSlots[j]);
-        }
+        SwapItemSlots(&itemSlots[0], &itemSlots[i - 1]);
+        SiftDownItemSlot(itemSlots, 0, i - 1);
     }
 }
 
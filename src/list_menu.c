@@ -53,6 +53,8 @@ struct RedArrowCursor
 static u8 ListMenuInitInternal(struct ListMenuTemplate *listMenuTemplate, u16 scrollOffset, u16 selectedRow);
 static bool8 ListMenuChangeSelection(struct ListMenu *list, bool8 updateCursorAndCallCallback, u8 count, bool8 movingDown);
 static void ListMenuPrintEntries(struct ListMenu *list, u16 startIndex, u16 yOffset, u16 count);
+static void ListMenuResetRowCache(u8 listTaskId);
+static void ListMenuCacheRows(struct ListMenu *list, u16 startIndex, u16 yOffset, u16 count);
 static void ListMenuDrawCursor(struct ListMenu *list);
 static void ListMenuCallSelectionChangedCallback(struct ListMenu *list, u8 onInit);
 static u8 ListMenuAddCursorObject(struct ListMenu *list, u32 cursorObjId);
@@ -79,6 +81,22 @@ static EWRAM_DATA struct {
 
 EWRAM_DATA struct ScrollArrowsTemplate gTempScrollArrowTemplate = {0};
 
+// Rows that scroll out of view are kept here, so that scrolling back to them
+// doesn't have to print them again. This is only done for lists without an
+// itemPrintFunc, as what a row looks like then only depends on its item.
+#define ROW_CACHE_SIZE 0x800
+#define ROW_CACHE_MAX_ROWS 4
+
+static EWRAM_DATA struct {
+    u32 pixels[ROW_CACHE_SIZE / 4];
+    const struct ListMenuItem *items;
+    u16 itemIndex[ROW_CACHE_MAX_ROWS];
+    u16 rowSize;
+    u8 listTaskId;
+    u8 numRows;
+    u8 nextRow;
+} sRowCache = {0};
+
 // IWRAM common
 COMMON_DATA struct {
     u8 cursorPal:4;
@@ -464,6 +482,9 @@ void DestroyListMenuTask(u8 listTaskId, u16 *scrollOffset, u16 *selectedRow)
     if (list->taskId != TASK_NONE)
         ListMenuRemoveCursorObject(list->taskId, list->template.cursorKind - CURSOR_OBJECT_START);
 
+    if (sRowCache.listTaskId == listTaskId)
+        sRowCache.numRows = 0;
+
     DestroyTask(listTaskId);
 }
 
@@ -471,6 +492,8 @@ void RedrawListMenu(u8 listTaskId)
 {
     struct ListMenu *list = (void *) gTasks[listTaskId].data;
 
+    // Redrawing usually means the items changed
+    ListMenuResetRowCache(listTaskId);
     FillWindowPixelBuffer(list->template.windowId, PIXEL_FILL(list->template.fillValue));
     ListMenuPrintEntries(list, list->scrollOffset, 0, list->template.maxShowed);
     ListMenuDrawCursor(list);
@@ -485,6 +508,7 @@ void ChangeListMenuPals(u8 listTaskId, u8 cursorPal, u8 fillValue, u8 cursorShad
     list->template.cursorPal = cursorPal;
     list->template.fillValue = fillValue;
     list->template.cursorShadowPal = cursorShadowPal;
+    ListMenuResetRowCache(listTaskId);
 }
 
 // unused
@@ -569,6 +593,7 @@ static u8 ListMenuInitInternal(struct ListMenuTemplate *listMenuTemplate, u16 sc
     if (list->template.totalItems < list->template.maxShowed)
         list->template.maxShowed = list->template.totalItems;
 
+    ListMenuResetRowCache(listTaskId);
     FillWindowPixelBuffer(list->template.windowId, PIXEL_FILL(list->template.fillValue));
     ListMenuPrintEntries(list, list->scrollOffset, 0, list->template.maxShowed);
     ListMenuDrawCursor(list);
@@ -606,6 +631,107 @@ static void ListMenuPrint(struct ListMenu *list, const u8 *str, u8 x, u8 y)
     }
 }
 
+static void ListMenuResetRowCache(u8 listTaskId)
+{
+    struct ListMenu *list = (void *) gTasks[listTaskId].data;
+    u8 yMultiplier = GetFontAttribute(list->template.fontId, FONTATTR_MAX_LETTER_HEIGHT) + list->template.itemVerticalPadding;
+    u32 rowSize = GetWindowAttribute(list->template.windowId, WINDOW_WIDTH) * 4 * yMultiplier;
+    u32 listHeight = list->template.maxShowed * yMultiplier + list->template.upText_Y;
+
+    sRowCache.numRows = 0;
+    sRowCache.nextRow = 0;
+    if (list->template.itemPrintFunc != NULL
+     || rowSize > ROW_CACHE_SIZE
+     || listHeight > GetWindowAttribute(list->template.windowId, WINDOW_HEIGHT) * 8)
+        return;
+
+    sRowCache.listTaskId = listTaskId;
+    sRowCache.items = list->template.items;
+    sRowCache.rowSize = rowSize;
+    sRowCache.numRows = ROW_CACHE_SIZE / rowSize;
+    if (sRowCache.numRows > ROW_CACHE_MAX_ROWS)
+        sRowCache.numRows = ROW_CACHE_MAX_ROWS;
+    memset(sRowCache.itemIndex, 0xFF, sizeof(sRowCache.itemIndex));
+}
+
+static bool32 IsRowCacheForList(struct ListMenu *list)
+{
+    return sRowCache.numRows != 0
+        && list == (struct ListMenu *)gTasks[sRowCache.listTaskId].data
+        && list->template.items == sRowCache.items;
+}
+
+// Copies the pixels of a row between the window and the cache. Rows don't line
+// up with tiles, so this goes through the window one line of pixels at a time.
+static void CopyRowPixels(struct ListMenu *list, u32 cacheRow, u8 y, bool32 toWindow)
+{
+    u32 width = GetWindowAttribute(list->template.windowId, WINDOW_WIDTH);
+    u8 *tileData = (u8 *)GetWindowAttribute(list->template.windowId, WINDOW_TILE_DATA);
+    u32 *cache = &sRowCache.pixels[cacheRow * sRowCache.rowSize / 4];
+    u32 *line;
+    u32 i, j, height = sRowCache.rowSize / (width * 4);
+
+    for (i = 0; i < height; i++, y++)
+    {
+        line = (u32 *)(tileData + (y / 8) * width * TILE_SIZE_4BPP + (y % 8) * 4);
+        for (j = 0; j < width; j++, cache++)
+        {
+            if (toWindow)
+                line[j * TILE_SIZE_4BPP / 4] = *cache;
+            else
+                *cache = line[j * TILE_SIZE_4BPP / 4];
+        }
+    }
+}
+
+// Saves rows that are about to scroll out of view
+static void ListMenuCacheRows(struct ListMenu *list, u16 startIndex, u16 yOffset, u16 count)
+{
+    s32 i;
+    u8 yMultiplier;
+
+    if (!IsRowCacheForList(list))
+        return;
+
+    yMultiplier = GetFontAttribute(list->template.fontId, FONTATTR_MAX_LETTER_HEIGHT) + list->template.itemVerticalPadding;
+    for (i = 0; i < count; i++)
+    {
+        u32 j;
+
+        // Already cached from an earlier scroll
+        for (j = 0; j < sRowCache.numRows; j++)
+        {
+            if (sRowCache.itemIndex[j] == startIndex + i)
+                break;
+        }
+        if (j != sRowCache.numRows)
+            continue;
+
+        CopyRowPixels(list, sRowCache.nextRow, (yOffset + i) * yMultiplier + list->template.upText_Y, FALSE);
+        sRowCache.itemIndex[sRowCache.nextRow] = startIndex + i;
+        if (++sRowCache.nextRow >= sRowCache.numRows)
+            sRowCache.nextRow = 0;
+    }
+}
+
+static bool32 ListMenuRestoreRow(struct ListMenu *list, u16 itemIndex, u8 y)
+{
+    u32 i;
+
+    if (!IsRowCacheForList(list))
+        return FALSE;
+
+    for (i = 0; i < sRowCache.numRows; i++)
+    {
+        if (sRowCache.itemIndex[i] == itemIndex)
+        {
+            CopyRowPixels(list, i, y, TRUE);
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
 static void ListMenuPrintEntries(struct ListMenu *list, u16 startIndex, u16 yOffset, u16 count)
 {
     s32 i;
@@ -614,12 +740,18 @@ static void ListMenuPrintEntries(struct ListMenu *list, u16 startIndex, u16 yOff
 
     for (i = 0; i < count; i++)
     {
+        y = (yOffset + i) * yMultiplier + list->template.upText_Y;
+        if (!gListMenuOverride.enabled && ListMenuRestoreRow(list, startIndex, y))
+        {
+            startIndex++;
+            continue;
+        }
+
         if (list->template.items[startIndex].id != LIST_HEADER)
             x = list->template.item_X;
         else
             x = list->template.header_X;
 
-        y = (yOffset + i) * yMultiplier + list->template.upText_Y;
         if (list->template.itemPrintFunc != NULL)
             list->template.itemPrintFunc(list->template.windowId, list->template.items[startIndex].id, y);
 
@@ -791,6 +923,7 @@ static void ListMenuScroll(struct ListMenu *list, u8 count, bool8 movingDown)
         {
             u16 y, width, height;
 
+            ListMenuCacheRows(list, list->scrollOffset + list->template.maxShowed, list->template.maxShowed - count, count);
             ScrollWindow(list->template.windowId, 1, count * yMultiplier, PIXEL_FILL(list->template.fillValue));
             ListMenuPrintEntries(list, list->scrollOffset, 0, count);
 
@@ -805,6 +938,7 @@ static void ListMenuScroll(struct ListMenu *list, u8 count, bool8 movingDown)
         {
             u16 width;
 
+            ListMenuCacheRows(list, list->scrollOffset - count, 0, count);
             ScrollWindow(list->template.windowId, 0, count * yMultiplier, PIXEL_FILL(list->template.fillValue));
             ListMenuPrintEntries(list, list->scrollOffset + (list->template.maxShowed - count), list->template.maxShowed - count, count);
 
@@ -816,6 +950,33 @@ static void ListMenuScroll(struct ListMenu *list, u8 count, bool8 movingDown)
     }
 }
 
+// When only the cursor moved, only the tiles under its old and new position have to be uploaded.
+// A custom moveCursorFunc could have drawn anywhere in the window though.
+static void ListMenuCopyCursorRowsToVram(struct ListMenu *list, u16 oldSelectedRow)
+{
+    u8 yMultiplier, height;
+    u16 top, bottom;
+
+    if ((list->template.moveCursorFunc != NULL && list->template.moveCursorFunc != ListMenuDefaultCursorMoveFunc)
+     || list->template.cursorKind != CURSOR_BLACK_ARROW)
+    {
+        CopyWindowToVram(list->template.windowId, COPYWIN_GFX);
+        return;
+    }
+
+    yMultiplier = GetFontAttribute(list->template.fontId, FONTATTR_MAX_LETTER_HEIGHT) + list->template.itemVerticalPadding;
+    height = GetMenuCursorDimensionByFont(list->template.fontId, 1);
+    top = min(oldSelectedRow, list->selectedRow) * yMultiplier + list->template.upText_Y;
+    bottom = max(oldSelectedRow, list->selectedRow) * yMultiplier + list->template.upText_Y + height - 1;
+    if (bottom >= GetWindowAttribute(list->template.windowId, WINDOW_HEIGHT) * 8)
+        bottom = GetWindowAttribute(list->template.windowId, WINDOW_HEIGHT) * 8 - 1;
+
+    CopyWindowRectToVram(list->template.windowId, COPYWIN_GFX,
+                         0, top / 8,
+                         GetWindowAttribute(list->template.windowId, WINDOW_WIDTH),
+                         bottom / 8 - top / 8 + 1);
+}
+
 static bool8 ListMenuChangeSelection(struct ListMenu *list, bool8 updateCursorAndCallCallback, u8 count, bool8 movingDown)
 {
     u16 oldSelectedRow;
@@ -847,7 +1008,7 @@ static bool8 ListMenuChangeSelection(struct ListMenu *list, bool8 updateCursorAn
             ListMenuErasePrintedCursor(list, oldSelectedRow);
             ListMenuDrawCursor(list);
             ListMenuCallSelectionChangedCallback(list, FALSE);
-            CopyWindowToVram(list->template.windowId, COPYWIN_GFX);
+            ListMenuCopyCursorRowsToVram(list, oldSelectedRow);
             break;
         case 2:
         case 3:
@@ -985,6 +1146,7 @@ void ListMenuSetTemplateField(u8 taskId, u8 field, s32 value)
         data->template.cursorKind = value;
         break;
     }
+    ListMenuResetRowCache(taskId);
 }
 
 #define tState data[0]
@@ -31,12 +31,7 @@ void ResetLotteryCorner(void)
 
 void SetRandomLotteryNumber(u16 i)
 {
-    u32 var = Random();
-
-    while (--i != 0xFFFF)
-        var = ISO_RANDOMIZE2(var);
-
-    SetLotteryNumber(var);
+    SetLotteryNumber(ISO_RANDOMIZE2_N(Random(), i));
 }
 
 void RetrieveLotteryNumber(void)
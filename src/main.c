@@ -20,8 +20,10 @@
 #include "battle.h"
 #include "battle_controllers.h"
 #include "text.h"
+#include "trig.h"
 #include "intro.h"
 #include "main.h"
+#include "state_hash.h"
 #include "trainer_hill.h"
 #include "constants/rgb.h"
 
@@ -98,6 +100,7 @@ void AgbMain(void)
     REG_WAITCNT = WAITCNT_PREFETCH_ENABLE | WAITCNT_WS0_S_1 | WAITCNT_WS0_N_3;
     InitKeys();
     InitIntrHandlers();
+    InitTrigBatchFuncs();
     m4aSoundInit();
     EnableVCountIntrAtLine150();
     InitRFU();
@@ -164,6 +167,7 @@ void AgbMain(void)
 
         PlayTimeCounter_Update();
         MapMusicMain();
+        FRAME_HASH_LOG_POINT();
         WaitForVBlank();
     }
 }
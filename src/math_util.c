@@ -1,4 +1,44 @@
 #include "global.h"
+#include "math_util.h"
+
+// ceil(2^32 / d) for d = 2 to 256. Multiplying by these and keeping the high
+// word gives x / d exactly for any x below 2^24.
+const u32 gReciprocalTable[] =
+{
+    0x00000000, 0x00000000, 0x80000000, 0x55555556, 0x40000000, 0x33333334, 0x2AAAAAAB, 0x24924925,
+    0x20000000, 0x1C71C71D, 0x1999999A, 0x1745D175, 0x15555556, 0x13B13B14, 0x12492493, 0x11111112,
+    0x10000000, 0x0F0F0F10, 0x0E38E38F, 0x0D79435F, 0x0CCCCCCD, 0x0C30C30D, 0x0BA2E8BB, 0x0B21642D,
+    0x0AAAAAAB, 0x0A3D70A4, 0x09D89D8A, 0x097B425F, 0x0924924A, 0x08D3DCB1, 0x08888889, 0x08421085,
+    0x08000000, 0x07C1F07D, 0x07878788, 0x07507508, 0x071C71C8, 0x06EB3E46, 0x06BCA1B0, 0x06906907,
+    0x06666667, 0x063E7064, 0x06186187, 0x05F417D1, 0x05D1745E, 0x05B05B06, 0x0590B217, 0x0572620B,
+    0x05555556, 0x0539782A, 0x051EB852, 0x05050506, 0x04EC4EC5, 0x04D4873F, 0x04BDA130, 0x04A7904B,
+    0x04924925, 0x047DC120, 0x0469EE59, 0x0456C798, 0x04444445, 0x04325C54, 0x04210843, 0x04104105,
+    0x04000000, 0x03F03F04, 0x03E0F83F, 0x03D22636, 0x03C3C3C4, 0x03B5CC0F, 0x03A83A84, 0x039B0AD2,
+    0x038E38E4, 0x0381C0E1, 0x03759F23, 0x0369D037, 0x035E50D8, 0x03531DED, 0x03483484, 0x033D91D3,
+    0x03333334, 0x03291620, 0x031F3832, 0x03159722, 0x030C30C4, 0x03030304, 0x02FA0BE9, 0x02F14991,
+    0x02E8BA2F, 0x02E05C0C, 0x02D82D83, 0x02D02D03, 0x02C8590C, 0x02C0B02D, 0x02B93106, 0x02B1DA47,
+    0x02AAAAAB, 0x02A3A0FE, 0x029CBC15, 0x0295FAD5, 0x028F5C29, 0x0288DF0D, 0x02828283, 0x027C4598,
+    0x02762763, 0x02702703, 0x026A43A0, 0x02647C6A, 0x025ED098, 0x02593F6A, 0x0253C826, 0x024E6A18,
+    0x02492493, 0x0243F6F1, 0x023EE090, 0x0239E0D6, 0x0234F72D, 0x02302303, 0x022B63CC, 0x0226B903,
+    0x02222223, 0x021D9EAE, 0x02192E2A, 0x0214D022, 0x02108422, 0x020C49BB, 0x02082083, 0x02040811,
+    0x02000000, 0x01FC07F1, 0x01F81F82, 0x01F4465A, 0x01F07C20, 0x01ECC07C, 0x01E9131B, 0x01E573AD,
+    0x01E1E1E2, 0x01DE5D6F, 0x01DAE608, 0x01D77B66, 0x01D41D42, 0x01D0CB59, 0x01CD8569, 0x01CA4B31,
+    0x01C71C72, 0x01C3F8F1, 0x01C0E071, 0x01BDD2B9, 0x01BACF92, 0x01B7D6C4, 0x01B4E81C, 0x01B20365,
+    0x01AF286C, 0x01AC5702, 0x01A98EF7, 0x01A6D01B, 0x01A41A42, 0x01A16D40, 0x019EC8EA, 0x019C2D15,
+    0x0199999A, 0x01970E50, 0x01948B10, 0x01920FB5, 0x018F9C19, 0x018D3019, 0x018ACB91, 0x01886E60,
+    0x01861862, 0x0183C978, 0x01818182, 0x017F4060, 0x017D05F5, 0x017AD221, 0x0178A4C9, 0x01767DCF,
+    0x01745D18, 0x01724288, 0x01702E06, 0x016E1F77, 0x016C16C2, 0x016A13CE, 0x01681682, 0x01661EC7,
+    0x01642C86, 0x01623FA8, 0x01605817, 0x015E75BC, 0x015C9883, 0x015AC057, 0x0158ED24, 0x01571ED4,
+    0x01555556, 0x01539095, 0x0151D07F, 0x01501502, 0x014E5E0B, 0x014CAB89, 0x014AFD6B, 0x0149539F,
+    0x0147AE15, 0x01460CBD, 0x01446F87, 0x0142D663, 0x01414142, 0x013FB014, 0x013E22CC, 0x013C995B,
+    0x013B13B2, 0x013991C3, 0x01381382, 0x013698E0, 0x013521D0, 0x0133AE46, 0x01323E35, 0x0130D191,
+    0x012F684C, 0x012E025D, 0x012C9FB5, 0x012B404B, 0x0129E413, 0x01288B02, 0x0127350C, 0x0125E228,
+    0x0124924A, 0x01234568, 0x0121FB79, 0x0120B471, 0x011F7048, 0x011E2EF4, 0x011CF06B, 0x011BB4A5,
+    0x011A7B97, 0x01194539, 0x01181182, 0x0116E069, 0x0115B1E6, 0x011485F1, 0x01135C82, 0x0112358F,
+    0x01111112, 0x010FEF02, 0x010ECF57, 0x010DB20B, 0x010C9715, 0x010B7E6F, 0x010A6811, 0x010953F4,
+    0x01084211, 0x01073261, 0x010624DE, 0x01051980, 0x01041042, 0x0103091C, 0x01020409, 0x01010102,
+    0x01000000,
+};
 
 s16 MathUtil_Mul16(s16 x, s16 y)
 {
@@ -84,3 +124,56 @@ s32 MathUtil_Inv32(s32 y)
     x = 0x10000;
     return x / y;
 }
+
+// x / d for x < 2^24 and 1 <= d <= 256, without a division
+u32 MathUtil_DivSmall(u32 x, u32 d)
+{
+    if (d <= 1)
+        return x;
+    return umul3232H32(x, gReciprocalTable[d]);
+}
+
+// Precomputes a reciprocal for dividing by d (d >= 1) with MathUtil_Divide.
+// The magic number is ((2^bits - d) * 2^32) / d + 1. 2^bits - d is always
+// less than d, so the quotient fits in 32 bits and is worked out one bit at a
+// time, without the 64-bit division from libgcc. That's 32 rounds of a few
+// Thumb instructions, about 450 cycles, so it only pays off for a divisor
+// that is reused many times.
+void MathUtil_InitDivisor(struct Divisor *div, u32 d)
+{
+    u32 bits = 0;
+    u32 remainder, quotient, i;
+
+    // bits = ceil(log2(d))
+    while (bits < 32 && (1u << bits) < d)
+        bits++;
+
+    remainder = (bits < 32) ? (1u << bits) - d : -d;
+    quotient = 0;
+    for (i = 0; i < 32; i++)
+    {
+        // remainder < d, so doubling it can carry out of 32 bits when
+        // d > 2^31. It's more than d then, and the subtraction wraps back.
+        u32 carry = remainder >> 31;
+
+        remainder <<= 1;
+        quotient <<= 1;
+        if (carry || remainder >= d)
+        {
+            remainder -= d;
+            quotient++;
+        }
+    }
+
+    div->magic = quotient + 1;
+    div->shift1 = (bits != 0) ? 1 : 0;
+    div->shift2 = (bits != 0) ? bits - 1 : 0;
+}
+
+// x / d, exact for every x
+u32 MathUtil_Divide(const struct Divisor *div, u32 x)
+{
+    u32 t = umul3232H32(x, div->magic);
+
+    return (t + ((x - t) >> div->shift1)) >> div->shift2;
+}
@@ -0,0 +1,101 @@
+#include "global.h"
+#include "main.h"
+#include "minigame_profiler.h"
+
+#ifdef MINIGAME_PROFILER
+
+// Scopes are timed in scanlines read from VCOUNT, so none of the hardware
+// timers the games or the sound engine use are touched. A frame is 228
+// scanlines, and the main callback has to finish inside one of them.
+#define SCANLINES_PER_FRAME 228
+
+// Averages and peaks are printed once a second.
+#define FRAMES_PER_REPORT 60
+
+struct MinigameProfile
+{
+    const char *game;
+    u16 scopeStart[MINIGAME_PROF_COUNT];
+    u16 frameLines[MINIGAME_PROF_COUNT];
+    u16 peakLines[MINIGAME_PROF_COUNT];
+    u32 totalLines[MINIGAME_PROF_COUNT];
+    u32 lastVBlank;
+    u16 frames;
+    u16 droppedFrames;
+};
+
+static void ResetMinigameProfile(const char *game);
+static void PrintMinigameProfile(void);
+
+EWRAM_DATA static struct MinigameProfile sProfile = {0};
+
+void MinigameProfiler_Begin(u8 scope)
+{
+    sProfile.scopeStart[scope] = REG_VCOUNT;
+}
+
+void MinigameProfiler_End(u8 scope)
+{
+    u32 now = REG_VCOUNT;
+
+    // A scope that runs past the end of the frame wraps back to line 0.
+    if (now < sProfile.scopeStart[scope])
+        now += SCANLINES_PER_FRAME;
+    sProfile.frameLines[scope] += now - sProfile.scopeStart[scope];
+}
+
+// Called at the end of the game's main callback.
+void MinigameProfiler_EndFrame(const char *game)
+{
+    s32 i;
+    u32 elapsed;
+
+    if (sProfile.game != game)
+        ResetMinigameProfile(game);
+
+    for (i = 0; i < MINIGAME_PROF_COUNT; i++)
+    {
+        sProfile.totalLines[i] += sProfile.frameLines[i];
+        if (sProfile.frameLines[i] > sProfile.peakLines[i])
+            sProfile.peakLines[i] = sProfile.frameLines[i];
+        sProfile.frameLines[i] = 0;
+    }
+
+    // The main callback runs once per frame, so a gap of more than one
+    // VBlank means the previous frame overran.
+    elapsed = gMain.vblankCounter1 - sProfile.lastVBlank;
+    if (elapsed > 1)
+        sProfile.droppedFrames += elapsed - 1;
+    sProfile.lastVBlank = gMain.vblankCounter1;
+
+    if (++sProfile.frames >= FRAMES_PER_REPORT)
+    {
+        PrintMinigameProfile();
+        ResetMinigameProfile(game);
+    }
+}
+
+static void ResetMinigameProfile(const char *game)
+{
+    memset(&sProfile, 0, sizeof(sProfile));
+    sProfile.game = game;
+    sProfile.lastVBlank = gMain.vblankCounter1;
+}
+
+static void PrintMinigameProfile(void)
+{
+    DebugPrintf("MINIGAMEPROF %s logic=%d/%d link=%d/%d sprites=%d/%d bg=%d/%d frames=%d dropped=%d",
+                sProfile.game,
+                sProfile.totalLines[MINIGAME_PROF_LOGIC] / sProfile.frames,
+                sProfile.peakLines[MINIGAME_PROF_LOGIC],
+                sProfile.totalLines[MINIGAME_PROF_LINK] / sProfile.frames,
+                sProfile.peakLines[MINIGAME_PROF_LINK],
+                sProfile.totalLines[MINIGAME_PROF_SPRITES] / sProfile.frames,
+                sProfile.peakLines[MINIGAME_PROF_SPRITES],
+                sProfile.totalLines[MINIGAME_PROF_BG] / sProfile.frames,
+                sProfile.peakLines[MINIGAME_PROF_BG],
+                sProfile.frames,
+                sProfile.droppedFrames);
+}
+
+#endif // MINIGAME_PROFILER
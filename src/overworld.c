@@ -1845,6 +1845,7 @@ static bool32 LoadMapInStepsLink(u8 *state)
         (*state)++;
         break;
     case 6:
+        SetKeepMapTilesetsInVram(FALSE);
         CopyPrimaryTilesetToVram(gMapHeader.mapLayout);
         (*state)++;
         break;
@@ -1905,39 +1906,44 @@ static bool32 LoadMapInStepsLocal(u8 *state, bool32 a2)
         (*state)++;
         break;
     case 3:
-        InitObjectEventsLocal();
-        SetCameraToTrackPlayer();
-        (*state)++;
-        break;
-    case 4:
         InitCurrentFlashLevelScanlineEffect();
         InitOverworldGraphicsRegisters();
         InitTextBoxGfxAndPrinters();
         (*state)++;
         break;
+    // The tilesets are decompressed and queued for VRAM as early as the bg
+    // setup allows, so their copies can go out during the next VBlank while
+    // the object events and the map view are being set up, instead of the
+    // load sitting idle in the wait for them below.
+    case 4:
+        CopyPrimaryTilesetToVram(gMapHeader.mapLayout);
+        (*state)++;
+        break;
     case 5:
-        ResetFieldCamera();
+        CopySecondaryTilesetToVram(gMapHeader.mapLayout);
+        SetKeepMapTilesetsInVram(FALSE);
         (*state)++;
         break;
     case 6:
-        CopyPrimaryTilesetToVram(gMapHeader.mapLayout);
+        InitObjectEventsLocal();
+        SetCameraToTrackPlayer();
         (*state)++;
         break;
     case 7:
-        CopySecondaryTilesetToVram(gMapHeader.mapLayout);
+        ResetFieldCamera();
         (*state)++;
         break;
     case 8:
+        DrawWholeMapView();
+        (*state)++;
+        break;
+    case 9:
         if (FreeTempTileDataBuffersIfPossible() != TRUE)
         {
             LoadMapTilesetPalettes(gMapHeader.mapLayout);
             (*state)++;
         }
         break;
-    case 9:
-        DrawWholeMapView();
-        (*state)++;
-        break;
     case 10:
         InitTilesetAnimations();
         (*state)++;
@@ -2017,6 +2023,7 @@ static bool32 ReturnToFieldLink(u8 *state)
         (*state)++;
         break;
     case 5:
+        SetKeepMapTilesetsInVram(FALSE);
         CopyPrimaryTilesetToVram(gMapHeader.mapLayout);
         (*state)++;
         break;
@@ -16,6 +16,7 @@
 #include "item.h"
 #include "link.h"
 #include "main.h"
+#include "math_util.h"
 #include "overworld.h"
 #include "m4a.h"
 #include "party_menu.h"
@@ -71,8 +72,11 @@ static bool8 ShouldGetStatBadgeBoost(u16 flagId, u8 battler);
 static u16 GiveMoveToBoxMon(struct BoxPokemon *boxMon, u16 move);
 static bool8 ShouldSkipFriendshipChange(void);
 static u8 CopyMonToPC(struct Pokemon *mon);
+static u8 GetLevelUpLearnsetLength(u16 species);
+static u8 GetRelearnableMoves(u16 species, u8 level, const u16 *learnedMoves, u16 *moves);
 
 EWRAM_DATA static u8 sLearningMoveTableID = 0;
+EWRAM_DATA static u8 sLevelUpLearnsetLengths[NUM_SPECIES] = {0};
 EWRAM_DATA u8 gPlayerPartyCount = 0;
 EWRAM_DATA u8 gEnemyPartyCount = 0;
 EWRAM_DATA struct Pokemon gPlayerParty[PARTY_SIZE] = {0};
@@ -2814,7 +2818,7 @@ static u16 CalculateBoxMonChecksum(struct BoxPokemon *boxMon)
 #define CALC_STAT(base, iv, ev, statIndex, field)               \
 {                                                               \
     u8 baseStat = gSpeciesInfo[species].base;                   \
-    s32 n = (((2 * baseStat + iv + ev / 4) * level) / 100) + 5; \
+    s32 n = UDIV_CONST((2 * baseStat + iv + ev / 4) * level, 100) + 5; \
     u8 nature = GetNature(mon);                                 \
     n = ModifyStatByNature(nature, n, statIndex);               \
     SetMonData(mon, field, &n);                                 \
@@ -2849,7 +2853,8 @@ void CalculateMonStats(struct Pokemon *mon)
     else
     {
         s32 n = 2 * gSpeciesInfo[species].baseHP + hpIV;
-        newMaxHP = (((n + hpEV / 4) * level) / 100) + level + 10;
+        // At most (2 * 255 + 31 + 63) * 100, well in range for UDIV_CONST
+        newMaxHP = UDIV_CONST((n + hpEV / 4) * level, 100) + level + 10;
     }
 
     gBattleScripting.levelUpHP = newMaxHP - oldMaxHP;
@@ -2992,19 +2997,12 @@ void GiveBoxMonInitialMoveset(struct BoxPokemon *boxMon)
 {
     u16 species = GetBoxMonData(boxMon, MON_DATA_SPECIES, NULL);
     s32 level = GetLevelFromBoxMonExp(boxMon);
+    s32 numMoves = CountLevelUpMovesUpToLevel(species, level);
     s32 i;
 
-    for (i = 0; gLevelUpLearnsets[species][i] != LEVEL_UP_END; i++)
+    for (i = 0; i < numMoves; i++)
     {
-        u16 moveLevel;
-        u16 move;
-
-        moveLevel = (gLevelUpLearnsets[species][i] & LEVEL_UP_MOVE_LV);
-
-        if (moveLevel > (level << 9))
-            break;
-
-        move = (gLevelUpLearnsets[species][i] & LEVEL_UP_MOVE_ID);
+        u16 move = (gLevelUpLearnsets[species][i] & LEVEL_UP_MOVE_ID);
 
         if (GiveMoveToBoxMon(boxMon, move) == MON_HAS_MAX_MOVES)
             DeleteFirstMoveAndGiveMoveToBoxMon(boxMon, move);
@@ -3023,14 +3021,12 @@ u16 MonTryLearningNewMove(struct Pokemon *mon, bool8 firstMove)
     // you to learn the same move over and over again
     if (firstMove)
     {
-        sLearningMoveTableID = 0;
+        // Skip straight to the first move learned at this level. If there
+        // is none this lands on a later move or LEVEL_UP_END instead.
+        sLearningMoveTableID = CountLevelUpMovesUpToLevel(species, level - 1);
 
-        while ((gLevelUpLearnsets[species][sLearningMoveTableID] & LEVEL_UP_MOVE_LV) != (level << 9))
-        {
-            sLearningMoveTableID++;
-            if (gLevelUpLearnsets[species][sLearningMoveTableID] == LEVEL_UP_END)
-                return MOVE_NONE;
-        }
+        if ((gLevelUpLearnsets[species][sLearningMoveTableID] & LEVEL_UP_MOVE_LV) != (level << 9))
+            return MOVE_NONE;
     }
 
     if ((gLevelUpLearnsets[species][sLearningMoveTableID] & LEVEL_UP_MOVE_LV) == (level << 9))
@@ -3243,7 +3239,7 @@ s32 CalculateBaseDamage(struct BattlePokemon *attacker, struct BattlePokemon *de
             APPLY_STAT_MOD(damage, attacker, attack, STAT_ATK)
 
         damage = damage * gBattleMovePower;
-        damage *= (2 * attacker->level / 5 + 2);
+        damage *= (UDIV_CONST(2 * attacker->level, 5) + 2);
 
         if (gCritMultiplier == 2)
         {
@@ -3298,7 +3294,7 @@ s32 CalculateBaseDamage(struct BattlePokemon *attacker, struct BattlePokemon *de
             APPLY_STAT_MOD(damage, attacker, spAttack, STAT_SPATK)
 
         damage = damage * gBattleMovePower;
-        damage *= (2 * attacker->level / 5 + 2);
+        damage *= (UDIV_CONST(2 * attacker->level, 5) + 2);
 
         if (gCritMultiplier == 2)
         {
@@ -5491,14 +5487,24 @@ u16 GetEvolutionTargetSpecies(struct Pokemon *mon, u8 mode, u16 evolutionItem)
     int i;
     u16 targetSpecies = 0;
     u16 species = GetMonData(mon, MON_DATA_SPECIES, 0);
-    u16 heldItem = GetMonData(mon, MON_DATA_HELD_ITEM, 0);
-    u32 personality = GetMonData(mon, MON_DATA_PERSONALITY, 0);
+    u16 heldItem;
+    u32 personality;
     u8 level;
     u16 friendship;
-    u8 beauty = GetMonData(mon, MON_DATA_BEAUTY, 0);
-    u16 upperPersonality = personality >> 16;
+    u8 beauty;
+    u16 upperPersonality;
     u8 holdEffect;
 
+    // Most party members are fully evolved, so skip decrypting the rest of
+    // their data when the species has nothing to evolve into.
+    if (gEvolutionTable[species][0].method == 0)
+        return SPECIES_NONE;
+
+    heldItem = GetMonData(mon, MON_DATA_HELD_ITEM, 0);
+    personality = GetMonData(mon, MON_DATA_PERSONALITY, 0);
+    beauty = GetMonData(mon, MON_DATA_BEAUTY, 0);
+    upperPersonality = personality >> 16;
+
     if (heldItem == ITEM_ENIGMA_BERRY)
         holdEffect = gSaveBlock1Ptr->enigmaBerry.holdEffect;
     else
@@ -6286,45 +6292,134 @@ u32 CanSpeciesLearnTMHM(u16 species, u8 tm)
     }
 }
 
-u8 GetMoveRelearnerMoves(struct Pokemon *mon, u16 *moves)
+// Returns the first TM/HM from tm onwards that the species can learn, or
+// NUM_TECHNICAL_MACHINES + NUM_HIDDEN_MACHINES if there are no more. Used to
+// visit only the learnable TMs/HMs instead of checking each one:
+//   for (tm = GetNextSpeciesTMHM(species, 0); tm < NUM_TECHNICAL_MACHINES + NUM_HIDDEN_MACHINES; tm = GetNextSpeciesTMHM(species, tm + 1))
+u8 GetNextSpeciesTMHM(u16 species, u8 tm)
 {
-    u16 learnedMoves[MAX_MON_MOVES];
-    u8 numMoves = 0;
-    u16 species = GetMonData(mon, MON_DATA_SPECIES, 0);
-    u8 level = GetMonData(mon, MON_DATA_LEVEL, 0);
-    int i, j, k;
+    u32 index = tm / 32;
+    u32 bits;
 
-    for (i = 0; i < MAX_MON_MOVES; i++)
-        learnedMoves[i] = GetMonData(mon, MON_DATA_MOVE1 + i, 0);
+    if (species == SPECIES_EGG || index >= ARRAY_COUNT(gTMHMLearnsets[0].as_u32s))
+        return NUM_TECHNICAL_MACHINES + NUM_HIDDEN_MACHINES;
 
-    for (i = 0; i < MAX_LEVEL_UP_MOVES; i++)
+    bits = gTMHMLearnsets[species].as_u32s[index] & (0xFFFFFFFF << (tm % 32));
+    while (bits == 0)
     {
-        u16 moveLevel;
+        if (++index >= ARRAY_COUNT(gTMHMLearnsets[0].as_u32s))
+            return NUM_TECHNICAL_MACHINES + NUM_HIDDEN_MACHINES;
+        bits = gTMHMLearnsets[species].as_u32s[index];
+    }
 
-        if (gLevelUpLearnsets[species][i] == LEVEL_UP_END)
-            break;
+    tm = index * 32 + CountTrailingZeroBits(bits);
+    return min(tm, NUM_TECHNICAL_MACHINES + NUM_HIDDEN_MACHINES);
+}
 
-        moveLevel = gLevelUpLearnsets[species][i] & LEVEL_UP_MOVE_LV;
+// Returns how many TMs/HMs the species can learn.
+u8 CountSpeciesTMHMs(u16 species)
+{
+    u32 i;
+    u32 count = 0;
 
-        if (moveLevel <= (level << 9))
-        {
-            for (j = 0; j < MAX_MON_MOVES && learnedMoves[j] != (gLevelUpLearnsets[species][i] & LEVEL_UP_MOVE_ID); j++)
-                ;
+    if (species == SPECIES_EGG)
+        return 0;
 
-            if (j == MAX_MON_MOVES)
-            {
-                for (k = 0; k < numMoves && moves[k] != (gLevelUpLearnsets[species][i] & LEVEL_UP_MOVE_ID); k++)
-                    ;
+    for (i = 0; i < ARRAY_COUNT(gTMHMLearnsets[0].as_u32s); i++)
+    {
+        u32 bits = gTMHMLearnsets[species].as_u32s[i];
 
-                if (k == numMoves)
-                    moves[numMoves++] = gLevelUpLearnsets[species][i] & LEVEL_UP_MOVE_ID;
-            }
+        bits = bits - ((bits >> 1) & 0x55555555);
+        bits = (bits & 0x33333333) + ((bits >> 2) & 0x33333333);
+        bits = (bits + (bits >> 4)) & 0x0F0F0F0F;
+        count += (bits * 0x01010101) >> 24;
+    }
+
+    return count;
+}
+
+static u8 GetLevelUpLearnsetLength(u16 species)
+{
+    if (sLevelUpLearnsetLengths[species] == 0)
+    {
+        u8 i;
+
+        for (i = 0; gLevelUpLearnsets[species][i] != LEVEL_UP_END; i++)
+            ;
+        sLevelUpLearnsetLengths[species] = i;
+    }
+
+    return sLevelUpLearnsetLengths[species];
+}
+
+// Returns how many of the species' level up moves are learned at or before
+// the given level. They are the ones at the start of its learnset.
+// Learnsets are sorted by level, so this is a binary search.
+u8 CountLevelUpMovesUpToLevel(u16 species, u8 level)
+{
+    const u16 *learnset = gLevelUpLearnsets[species];
+    u32 low = 0;
+    u32 high = GetLevelUpLearnsetLength(species);
+
+    while (low < high)
+    {
+        u32 mid = (low + high) / 2;
+
+        if ((learnset[mid] & LEVEL_UP_MOVE_LV) > (level << 9))
+            high = mid;
+        else
+            low = mid + 1;
+    }
+
+    return low;
+}
+
+// Fills moves with the level up moves up to the given level that are not in
+// learnedMoves, without repeats, and returns how many there are.
+static u8 GetRelearnableMoves(u16 species, u8 level, const u16 *learnedMoves, u16 *moves)
+{
+    u32 seenMoves[(LEVEL_UP_MOVE_ID + 1) / 32];
+    u8 numMoves = 0;
+    int i, numLearnsetMoves;
+
+    for (i = 0; i < ARRAY_COUNT(seenMoves); i++)
+        seenMoves[i] = 0;
+
+    // Moves already known count as seen, so they are never listed.
+    for (i = 0; i < MAX_MON_MOVES; i++)
+    {
+        u16 move = learnedMoves[i] & LEVEL_UP_MOVE_ID;
+        seenMoves[move / 32] |= 1u << (move % 32);
+    }
+
+    numLearnsetMoves = min(CountLevelUpMovesUpToLevel(species, level), MAX_LEVEL_UP_MOVES);
+    for (i = 0; i < numLearnsetMoves; i++)
+    {
+        u16 move = gLevelUpLearnsets[species][i] & LEVEL_UP_MOVE_ID;
+
+        if (!(seenMoves[move / 32] & (1u << (move % 32))))
+        {
+            seenMoves[move / 32] |= 1u << (move % 32);
+            moves[numMoves++] = move;
         }
     }
 
     return numMoves;
 }
 
+u8 GetMoveRelearnerMoves(struct Pokemon *mon, u16 *moves)
+{
+    u16 learnedMoves[MAX_MON_MOVES];
+    u16 species = GetMonData(mon, MON_DATA_SPECIES, 0);
+    u8 level = GetMonData(mon, MON_DATA_LEVEL, 0);
+    int i;
+
+    for (i = 0; i < MAX_MON_MOVES; i++)
+        learnedMoves[i] = GetMonData(mon, MON_DATA_MOVE1 + i, 0);
+
+    return GetRelearnableMoves(species, level, learnedMoves, moves);
+}
+
 u8 GetLevelUpMovesBySpecies(u16 species, u16 *moves)
 {
     u8 numMoves = 0;
@@ -6340,10 +6435,9 @@ u8 GetNumberOfRelearnableMoves(struct Pokemon *mon)
 {
     u16 learnedMoves[MAX_MON_MOVES];
     u16 moves[MAX_LEVEL_UP_MOVES];
-    u8 numMoves = 0;
     u16 species = GetMonData(mon, MON_DATA_SPECIES_OR_EGG, 0);
     u8 level = GetMonData(mon, MON_DATA_LEVEL, 0);
-    int i, j, k;
+    int i;
 
     if (species == SPECIES_EGG)
         return 0;
@@ -6351,32 +6445,7 @@ u8 GetNumberOfRelearnableMoves(struct Pokemon *mon)
     for (i = 0; i < MAX_MON_MOVES; i++)
         learnedMoves[i] = GetMonData(mon, MON_DATA_MOVE1 + i, 0);
 
-    for (i = 0; i < MAX_LEVEL_UP_MOVES; i++)
-    {
-        u16 moveLevel;
-
-        if (gLevelUpLearnsets[species][i] == LEVEL_UP_END)
-            break;
-
-        moveLevel = gLevelUpLearnsets[species][i] & LEVEL_UP_MOVE_LV;
-
-        if (moveLevel <= (level << 9))
-        {
-            for (j = 0; j < MAX_MON_MOVES && learnedMoves[j] != (gLevelUpLearnsets[species][i] & LEVEL_UP_MOVE_ID); j++)
-                ;
-
-            if (j == MAX_MON_MOVES)
-            {
-                for (k = 0; k < numMoves && moves[k] != (gLevelUpLearnsets[species][i] & LEVEL_UP_MOVE_ID); k++)
-                    ;
-
-                if (k == numMoves)
-                    moves[numMoves++] = gLevelUpLearnsets[species][i] & LEVEL_UP_MOVE_ID;
-            }
-        }
-    }
-
-    return numMoves;
+    return GetRelearnableMoves(species, level, learnedMoves, moves);
 }
 
 u16 SpeciesToPokedexNum(u16 species)
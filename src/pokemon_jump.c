@@ -13,6 +13,7 @@
 #include "main.h"
 #include "menu.h"
 #include "minigame_countdown.h"
+#include "minigame_profiler.h"
 #include "palette.h"
 #include "random.h"
 #include "digit_obj_util.h"
@@ -669,10 +670,17 @@ static void VBlankCB_PokemonJump(void)
 
 static void CB2_PokemonJump(void)
 {
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_LOGIC);
     RunTasks();
+    MINIGAME_PROF_END(MINIGAME_PROF_LOGIC);
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_SPRITES);
     AnimateSprites();
     BuildOamBuffer();
+    MINIGAME_PROF_END(MINIGAME_PROF_SPRITES);
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_BG);
     UpdatePaletteFade();
+    MINIGAME_PROF_END(MINIGAME_PROF_BG);
+    MINIGAME_PROF_END_FRAME("PokemonJump");
 }
 
 static void SetPokeJumpTask(TaskFunc func)
@@ -814,7 +822,9 @@ static bool32 (*const sPokeJumpLeaderFuncs[])(void) =
 
 static void Task_PokemonJump_Leader(u8 taskId)
 {
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_LINK);
     RecvLinkData_Leader();
+    MINIGAME_PROF_END(MINIGAME_PROF_LINK);
     TryUpdateScore();
     if (!sPokemonJump->funcActive && sPokemonJump->allPlayersReady)
     {
@@ -832,7 +842,9 @@ static void Task_PokemonJump_Leader(u8 taskId)
     }
 
     UpdateGame();
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_LINK);
     SendLinkData_Leader();
+    MINIGAME_PROF_END(MINIGAME_PROF_LINK);
 }
 
 static void SendLinkData_Leader(void)
@@ -913,7 +925,9 @@ static bool32 (*const sPokeJumpMemberFuncs[])(void) =
 
 static void Task_PokemonJump_Member(u8 taskId)
 {
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_LINK);
     RecvLinkData_Member();
+    MINIGAME_PROF_END(MINIGAME_PROF_LINK);
     if (sPokemonJump->funcActive)
     {
         if (!sPokeJumpMemberFuncs[sPokemonJump->comm.funcId]())
@@ -925,7 +939,9 @@ static void Task_PokemonJump_Member(u8 taskId)
     }
 
     UpdateGame();
+    MINIGAME_PROF_BEGIN(MINIGAME_PROF_LINK);
     SendLinkData_Member();
+    MINIGAME_PROF_END(MINIGAME_PROF_LINK);
 }
 
 static void SendLinkData_Member(void)
@@ -3,6 +3,7 @@
 
 EWRAM_DATA static u8 sUnknown = 0;
 EWRAM_DATA static u32 sRandCount = 0;
+EWRAM_DATA static u32 sRngStreamValues[RNG_STREAM_COUNT] = {0};
 
 // IWRAM common
 COMMON_DATA u32 gRngValue = 0;
@@ -15,10 +16,30 @@ u16 Random(void)
     return gRngValue >> 16;
 }
 
+void RandomFill(u16 *dest, u32 count)
+{
+    u32 value = gRngValue;
+    u32 i;
+
+    for (i = 0; i < count; i++)
+    {
+        value = ISO_RANDOMIZE1(value);
+        dest[i] = value >> 16;
+    }
+
+    gRngValue = value;
+    sRandCount += count;
+}
+
 void SeedRng(u16 seed)
 {
+    u32 i;
+
     gRngValue = seed;
     sUnknown = 0;
+
+    for (i = 0; i < RNG_STREAM_COUNT; i++)
+        sRngStreamValues[i] = seed + i + 1;
 }
 
 void SeedRng2(u16 seed)
@@ -31,3 +52,32 @@ u16 Random2(void)
     gRng2Value = ISO_RANDOMIZE1(gRng2Value);
     return gRng2Value >> 16;
 }
+
+// Uses the other LCG increment so that a stream seeded with the same value
+// as gRngValue still produces different numbers.
+u16 RandomFromStream(u32 stream)
+{
+    sRngStreamValues[stream] = ISO_RANDOMIZE2(sRngStreamValues[stream]);
+    return sRngStreamValues[stream] >> 16;
+}
+
+u32 AdvanceLcg(u32 seed, u32 multiplier, u32 increment, u32 steps)
+{
+    u32 accMultiplier = 1;
+    u32 accIncrement = 0;
+
+    // Compose the step with itself by repeated squaring, applying the
+    // powers of two that make up steps.
+    while (steps != 0)
+    {
+        if (steps & 1)
+        {
+            accMultiplier *= multiplier;
+            accIncrement = accIncrement * multiplier + increment;
+        }
+        increment *= multiplier + 1;
+        multiplier *= multiplier;
+        steps >>= 1;
+    }
+    return accMultiplier * seed + accIncrement;
+}
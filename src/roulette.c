@@ -363,6 +363,7 @@ static EWRAM_DATA struct Roulette
 static EWRAM_DATA u8 sTextWindowId = 0;
 
 static void Task_SpinWheel(u8);
+static void UpdateWheelRotation(void);
 static void Task_StartPlaying(u8);
 static void Task_ContinuePlaying(u8);
 static void Task_StopPlaying(u8);
@@ -1247,23 +1248,31 @@ static void CB2_LoadRoulette(void)
         gTasks[taskId].tCoins = GetCoins();
         AlertTVThatPlayerPlayedRoulette(GetCoins());
         sRoulette->spinTaskId = CreateTask(Task_SpinWheel, 1);
+        UpdateWheelRotation();
         SetMainCallback2(CB2_Roulette);
         return;
     }
     gMain.state++;
 }
 
+// The wheel only turns once every wheelDelay + 1 frames, so its rotation
+// matrix is only recalculated on those frames.
 static void Task_SpinWheel(u8 taskId)
 {
-    s16 sin;
-    s16 cos;
-
     if (sRoulette->wheelDelayTimer++ == sRoulette->wheelDelay)
     {
         sRoulette->wheelDelayTimer = 0;
         if ((sRoulette->wheelAngle -= sRoulette->wheelSpeed) < 0)
             sRoulette->wheelAngle = 360 - sRoulette->wheelSpeed;
+        UpdateWheelRotation();
     }
+}
+
+static void UpdateWheelRotation(void)
+{
+    s16 sin;
+    s16 cos;
+
     sin = Sin2(sRoulette->wheelAngle);
     cos = Cos2(sRoulette->wheelAngle);
     sin = sin / 16;
@@ -3507,6 +3516,7 @@ static u8 CreateWheelIconSprite(const struct SpriteTemplate *template, u8 r1, u1
     u8 spriteId = CreateSprite(template, 116, 80, template->oam->y);
     gSprites[spriteId].data[0] = *angle;
     gSprites[spriteId].data[1] = r1;
+    gSprites[spriteId].data[2] = -1;
     gSprites[spriteId].coordOffsetEnabled = TRUE;
     gSprites[spriteId].animPaused = TRUE;
     gSprites[spriteId].affineAnimPaused = TRUE;
@@ -3677,12 +3687,20 @@ static void CreateWheelIconSprites(void)
     }
 }
 
+// data[2] holds the wheel angle the icon was last placed at, so it is only
+// moved and rotated when the wheel has turned.
 static void SpriteCB_WheelIcon(struct Sprite *sprite)
 {
     s16 cos;
     s16 sin;
     u32 matrixNum;
-    s16 angle = sRoulette->wheelAngle + sprite->data[0];
+    s16 angle;
+
+    if (sprite->data[2] == sRoulette->wheelAngle)
+        return;
+    sprite->data[2] = sRoulette->wheelAngle;
+
+    angle = sRoulette->wheelAngle + sprite->data[0];
     if (angle >= 360)
         angle -= 360;
     sin = Sin2(angle);
@@ -411,6 +411,7 @@ struct SlotMachine
     /*0x5e*/ u16 winOut;
     /*0x60*/ u16 backupMapMusic;
     /*0x64*/ MainCallback prevMainCb;
+    /*0x68*/ u16 reelSymbolTileStarts[NUM_REELS][SYMBOLS_PER_REEL];
 };
 
 struct DigitalDisplaySprite
@@ -4089,15 +4090,35 @@ static void CreateReelSymbolSprites(void)
             sprite->data[3] = -1;
         }
     }
+
+    // The symbol sheets stay loaded for the whole game, so each reel's strip
+    // of symbols can be resolved to tile numbers once.
+    for (i = 0; i < NUM_REELS; i++)
+    {
+        for (j = 0; j < SYMBOLS_PER_REEL; j++)
+            sSlotMachine->reelSymbolTileStarts[i][j] = GetSpriteTileStartByTag(GFXTAG_SYMBOLS_START + sReelSymbols[i][j]);
+    }
 }
 
+// data[3] holds the reel position the sprite last showed, so the tiles are
+// only changed when a new symbol scrolls into its slot.
 static void SpriteCB_ReelSymbol(struct Sprite *sprite)
 {
+    s16 pos;
+
     sprite->data[2] = sSlotMachine->reelPixelOffsets[sprite->data[0]] + sprite->data[1];
     sprite->data[2] %= 120;
     sprite->y = sSlotMachine->reelShockOffsets[sprite->data[0]] + 28 + sprite->data[2];
-    sprite->sheetTileStart = GetSpriteTileStartByTag(GetSymbolAtRest(sprite->data[0], sprite->data[2] / 24));
-    SetSpriteSheetFrameTileNum(sprite);
+
+    pos = (sSlotMachine->reelPositions[sprite->data[0]] + sprite->data[2] / 24) % SYMBOLS_PER_REEL;
+    if (pos < 0)
+        pos += SYMBOLS_PER_REEL;
+    if (pos != sprite->data[3])
+    {
+        sprite->data[3] = pos;
+        sprite->sheetTileStart = sSlotMachine->reelSymbolTileStarts[sprite->data[0]][pos];
+        SetSpriteSheetFrameTileNum(sprite);
+    }
 }
 
 static void CreateCreditPayoutNumberSprites(void)
@@ -0,0 +1,499 @@
+#include "global.h"
+#include "battle.h"
+#include "main.h"
+#include "pokemon.h"
+#include "pokemon_storage_system.h"
+#include "random.h"
+#include "sprite.h"
+#include "state_hash.h"
+#include "task.h"
+
+// FNV-1a, but mixing in a word at a time where the data is aligned.
+#define HASH_OFFSET_BASIS 0x811C9DC5
+#define HASH_PRIME        0x01000193
+
+struct StateField
+{
+    const char *name;
+    u16 offset;
+};
+
+struct StateBlock
+{
+    const char *name;
+    u16 size;
+    u8 count;
+#ifdef STATE_HASH_LOG
+    u8 fieldCount;
+    const struct StateField *fields;
+#endif
+};
+
+#ifdef STATE_HASH_LOG
+
+#define STATE_FIELD(type, field) {#field, offsetof(struct type, field)}
+
+// Bitfields have no offset of their own, so a run of them is listed under
+// its first member, starting right after the field before it.
+#define STATE_BITFIELDS(type, prevField, name) {name, offsetof(struct type, prevField) + sizeof(((struct type *)NULL)->prevField)}
+
+// Field hashes are printed this many to a line.
+#define FIELDS_PER_LINE 8
+
+EWRAM_DATA static u8 sLayoutsLogged = 0;
+
+static const struct StateField sSaveBlock2Fields[] =
+{
+    STATE_FIELD(SaveBlock2, playerName),
+    STATE_FIELD(SaveBlock2, playerGender),
+    STATE_FIELD(SaveBlock2, specialSaveWarpFlags),
+    STATE_FIELD(SaveBlock2, playerTrainerId),
+    STATE_FIELD(SaveBlock2, playTimeHours),
+    STATE_FIELD(SaveBlock2, playTimeMinutes),
+    STATE_FIELD(SaveBlock2, playTimeSeconds),
+    STATE_FIELD(SaveBlock2, playTimeVBlanks),
+    STATE_FIELD(SaveBlock2, optionsButtonMode),
+    STATE_BITFIELDS(SaveBlock2, optionsButtonMode, "optionsTextSpeed"),
+    STATE_FIELD(SaveBlock2, pokedex),
+    STATE_FIELD(SaveBlock2, filler_90),
+    STATE_FIELD(SaveBlock2, localTimeOffset),
+    STATE_FIELD(SaveBlock2, lastBerryTreeUpdate),
+    STATE_FIELD(SaveBlock2, gcnLinkFlags),
+    STATE_FIELD(SaveBlock2, encryptionKey),
+    STATE_FIELD(SaveBlock2, playerApprentice),
+    STATE_FIELD(SaveBlock2, apprentices),
+    STATE_FIELD(SaveBlock2, berryCrush),
+    STATE_FIELD(SaveBlock2, pokeJump),
+    STATE_FIELD(SaveBlock2, berryPick),
+    STATE_FIELD(SaveBlock2, hallRecords1P),
+    STATE_FIELD(SaveBlock2, hallRecords2P),
+    STATE_FIELD(SaveBlock2, contestLinkResults),
+    STATE_FIELD(SaveBlock2, frontier),
+};
+
+static const struct StateField sSaveBlock1Fields[] =
+{
+    STATE_FIELD(SaveBlock1, pos),
+    STATE_FIELD(SaveBlock1, location),
+    STATE_FIELD(SaveBlock1, continueGameWarp),
+    STATE_FIELD(SaveBlock1, dynamicWarp),
+    STATE_FIELD(SaveBlock1, lastHealLocation),
+    STATE_FIELD(SaveBlock1, escapeWarp),
+    STATE_FIELD(SaveBlock1, savedMusic),
+    STATE_FIELD(SaveBlock1, weather),
+    STATE_FIELD(SaveBlock1, weatherCycleStage),
+    STATE_FIELD(SaveBlock1, flashLevel),
+    STATE_FIELD(SaveBlock1, mapLayoutId),
+    STATE_FIELD(SaveBlock1, mapView),
+    STATE_FIELD(SaveBlock1, playerPartyCount),
+    STATE_FIELD(SaveBlock1, playerParty),
+    STATE_FIELD(SaveBlock1, money),
+    STATE_FIELD(SaveBlock1, coins),
+    STATE_FIELD(SaveBlock1, registeredItem),
+    STATE_FIELD(SaveBlock1, pcItems),
+    STATE_FIELD(SaveBlock1, bagPocket_Items),
+    STATE_FIELD(SaveBlock1, bagPocket_KeyItems),
+    STATE_FIELD(SaveBlock1, bagPocket_PokeBalls),
+    STATE_FIELD(SaveBlock1, bagPocket_TMHM),
+    STATE_FIELD(SaveBlock1, bagPocket_Berries),
+    STATE_FIELD(SaveBlock1, pokeblocks),
+    STATE_FIELD(SaveBlock1, seen1),
+    STATE_FIELD(SaveBlock1, berryBlenderRecords),
+    STATE_FIELD(SaveBlock1, unused_9C2),
+    STATE_FIELD(SaveBlock1, trainerRematchStepCounter),
+    STATE_FIELD(SaveBlock1, trainerRematches),
+    STATE_FIELD(SaveBlock1, objectEvents),
+    STATE_FIELD(SaveBlock1, objectEventTemplates),
+    STATE_FIELD(SaveBlock1, flags),
+    STATE_FIELD(SaveBlock1, vars),
+    STATE_FIELD(SaveBlock1, gameStats),
+    STATE_FIELD(SaveBlock1, berryTrees),
+    STATE_FIELD(SaveBlock1, secretBases),
+    STATE_FIELD(SaveBlock1, playerRoomDecorations),
+    STATE_FIELD(SaveBlock1, playerRoomDecorationPositions),
+    STATE_FIELD(SaveBlock1, decorationDesks),
+    STATE_FIELD(SaveBlock1, decorationChairs),
+    STATE_FIELD(SaveBlock1, decorationPlants),
+    STATE_FIELD(SaveBlock1, decorationOrnaments),
+    STATE_FIELD(SaveBlock1, decorationMats),
+    STATE_FIELD(SaveBlock1, decorationPosters),
+    STATE_FIELD(SaveBlock1, decorationDolls),
+    STATE_FIELD(SaveBlock1, decorationCushions),
+    STATE_FIELD(SaveBlock1, tvShows),
+    STATE_FIELD(SaveBlock1, pokeNews),
+    STATE_FIELD(SaveBlock1, outbreakPokemonSpecies),
+    STATE_FIELD(SaveBlock1, outbreakLocationMapNum),
+    STATE_FIELD(SaveBlock1, outbreakLocationMapGroup),
+    STATE_FIELD(SaveBlock1, outbreakPokemonLevel),
+    STATE_FIELD(SaveBlock1, outbreakUnused1),
+    STATE_FIELD(SaveBlock1, outbreakUnused2),
+    STATE_FIELD(SaveBlock1, outbreakPokemonMoves),
+    STATE_FIELD(SaveBlock1, outbreakUnused3),
+    STATE_FIELD(SaveBlock1, outbreakPokemonProbability),
+    STATE_FIELD(SaveBlock1, outbreakDaysLeft),
+    STATE_FIELD(SaveBlock1, gabbyAndTyData),
+    STATE_FIELD(SaveBlock1, easyChatProfile),
+    STATE_FIELD(SaveBlock1, easyChatBattleStart),
+    STATE_FIELD(SaveBlock1, easyChatBattleWon),
+    STATE_FIELD(SaveBlock1, easyChatBattleLost),
+    STATE_FIELD(SaveBlock1, mail),
+    STATE_FIELD(SaveBlock1, unlockedTrendySayings),
+    STATE_FIELD(SaveBlock1, oldMan),
+    STATE_FIELD(SaveBlock1, dewfordTrends),
+    STATE_FIELD(SaveBlock1, contestWinners),
+    STATE_FIELD(SaveBlock1, daycare),
+    STATE_FIELD(SaveBlock1, linkBattleRecords),
+    STATE_FIELD(SaveBlock1, giftRibbons),
+    STATE_FIELD(SaveBlock1, externalEventData),
+    STATE_FIELD(SaveBlock1, externalEventFlags),
+    STATE_FIELD(SaveBlock1, roamer),
+    STATE_FIELD(SaveBlock1, enigmaBerry),
+    STATE_FIELD(SaveBlock1, mysteryGift),
+    STATE_FIELD(SaveBlock1, unused_3598),
+    STATE_FIELD(SaveBlock1, trainerHillTimes),
+    STATE_FIELD(SaveBlock1, ramScript),
+    STATE_FIELD(SaveBlock1, recordMixingGift),
+    STATE_FIELD(SaveBlock1, seen2),
+    STATE_FIELD(SaveBlock1, lilycoveLady),
+    STATE_FIELD(SaveBlock1, trainerNameRecords),
+    STATE_FIELD(SaveBlock1, registeredTexts),
+    STATE_FIELD(SaveBlock1, unused_3D5A),
+    STATE_FIELD(SaveBlock1, trainerHill),
+    STATE_FIELD(SaveBlock1, waldaPhrase),
+};
+
+static const struct StateField sPokemonStorageFields[] =
+{
+    STATE_FIELD(PokemonStorage, currentBox),
+    STATE_FIELD(PokemonStorage, boxes),
+    STATE_FIELD(PokemonStorage, boxNames),
+    STATE_FIELD(PokemonStorage, boxWallpapers),
+};
+
+static const struct StateField sBattlePokemonFields[] =
+{
+    STATE_FIELD(BattlePokemon, species),
+    STATE_FIELD(BattlePokemon, attack),
+    STATE_FIELD(BattlePokemon, defense),
+    STATE_FIELD(BattlePokemon, speed),
+    STATE_FIELD(BattlePokemon, spAttack),
+    STATE_FIELD(BattlePokemon, spDefense),
+    STATE_FIELD(BattlePokemon, moves),
+    STATE_BITFIELDS(BattlePokemon, moves, "hpIV"),
+    STATE_FIELD(BattlePokemon, statStages),
+    STATE_FIELD(BattlePokemon, ability),
+    STATE_FIELD(BattlePokemon, types),
+    STATE_FIELD(BattlePokemon, unknown),
+    STATE_FIELD(BattlePokemon, pp),
+    STATE_FIELD(BattlePokemon, hp),
+    STATE_FIELD(BattlePokemon, level),
+    STATE_FIELD(BattlePokemon, friendship),
+    STATE_FIELD(BattlePokemon, maxHP),
+    STATE_FIELD(BattlePokemon, item),
+    STATE_FIELD(BattlePokemon, nickname),
+    STATE_FIELD(BattlePokemon, ppBonuses),
+    STATE_FIELD(BattlePokemon, otName),
+    STATE_FIELD(BattlePokemon, experience),
+    STATE_FIELD(BattlePokemon, personality),
+    STATE_FIELD(BattlePokemon, status1),
+    STATE_FIELD(BattlePokemon, status2),
+    STATE_FIELD(BattlePokemon, otId),
+};
+
+static const struct StateField sBattleStructFields[] =
+{
+    STATE_FIELD(BattleStruct, turnEffectsTracker),
+    STATE_FIELD(BattleStruct, turnEffectsBattlerId),
+    STATE_FIELD(BattleStruct, unused_0),
+    STATE_FIELD(BattleStruct, turnCountersTracker),
+    STATE_FIELD(BattleStruct, wrappedMove),
+    STATE_FIELD(BattleStruct, moveTarget),
+    STATE_FIELD(BattleStruct, expGetterMonId),
+    STATE_FIELD(BattleStruct, unused_1),
+    STATE_FIELD(BattleStruct, wildVictorySong),
+    STATE_FIELD(BattleStruct, dynamicMoveType),
+    STATE_FIELD(BattleStruct, wrappedBy),
+    STATE_FIELD(BattleStruct, assistPossibleMoves),
+    STATE_FIELD(BattleStruct, focusPunchBattlerId),
+    STATE_FIELD(BattleStruct, battlerPreventingSwitchout),
+    STATE_FIELD(BattleStruct, moneyMultiplier),
+    STATE_FIELD(BattleStruct, savedTurnActionNumber),
+    STATE_FIELD(BattleStruct, switchInAbilitiesCounter),
+    STATE_FIELD(BattleStruct, faintedActionsState),
+    STATE_FIELD(BattleStruct, faintedActionsBattlerId),
+    STATE_FIELD(BattleStruct, expValue),
+    STATE_FIELD(BattleStruct, scriptPartyIdx),
+    STATE_FIELD(BattleStruct, sentInPokes),
+    STATE_FIELD(BattleStruct, selectionScriptFinished),
+    STATE_FIELD(BattleStruct, battlerPartyIndexes),
+    STATE_FIELD(BattleStruct, monToSwitchIntoId),
+    STATE_FIELD(BattleStruct, battlerPartyOrders),
+    STATE_FIELD(BattleStruct, runTries),
+    STATE_FIELD(BattleStruct, caughtMonNick),
+    STATE_FIELD(BattleStruct, unused_2),
+    STATE_FIELD(BattleStruct, safariGoNearCounter),
+    STATE_FIELD(BattleStruct, safariPkblThrowCounter),
+    STATE_FIELD(BattleStruct, safariEscapeFactor),
+    STATE_FIELD(BattleStruct, safariCatchFactor),
+    STATE_FIELD(BattleStruct, linkBattleVsSpriteId_V),
+    STATE_FIELD(BattleStruct, linkBattleVsSpriteId_S),
+    STATE_FIELD(BattleStruct, formToChangeInto),
+    STATE_FIELD(BattleStruct, chosenMovePositions),
+    STATE_FIELD(BattleStruct, stateIdAfterSelScript),
+    STATE_FIELD(BattleStruct, unused_3),
+    STATE_FIELD(BattleStruct, prevSelectedPartySlot),
+    STATE_FIELD(BattleStruct, unused_4),
+    STATE_FIELD(BattleStruct, stringMoveType),
+    STATE_FIELD(BattleStruct, expGetterBattlerId),
+    STATE_FIELD(BattleStruct, unused_5),
+    STATE_FIELD(BattleStruct, absentBattlerFlags),
+    STATE_FIELD(BattleStruct, palaceFlags),
+    STATE_FIELD(BattleStruct, field_93),
+    STATE_FIELD(BattleStruct, wallyBattleState),
+    STATE_FIELD(BattleStruct, wallyMovesState),
+    STATE_FIELD(BattleStruct, wallyWaitFrames),
+    STATE_FIELD(BattleStruct, wallyMoveFrames),
+    STATE_FIELD(BattleStruct, lastTakenMove),
+    STATE_FIELD(BattleStruct, hpOnSwitchout),
+    STATE_FIELD(BattleStruct, savedBattleTypeFlags),
+    STATE_FIELD(BattleStruct, abilityPreventingSwitchout),
+    STATE_FIELD(BattleStruct, hpScale),
+    STATE_FIELD(BattleStruct, synchronizeMoveEffect),
+    STATE_FIELD(BattleStruct, anyMonHasTransformed),
+    STATE_FIELD(BattleStruct, savedCallback),
+    STATE_FIELD(BattleStruct, usedHeldItems),
+    STATE_FIELD(BattleStruct, chosenItem),
+    STATE_FIELD(BattleStruct, AI_itemType),
+    STATE_FIELD(BattleStruct, AI_itemFlags),
+    STATE_FIELD(BattleStruct, choicedMove),
+    STATE_FIELD(BattleStruct, changedItems),
+    STATE_FIELD(BattleStruct, intimidateBattler),
+    STATE_FIELD(BattleStruct, switchInItemsCounter),
+    STATE_FIELD(BattleStruct, arenaTurnCounter),
+    STATE_FIELD(BattleStruct, turnSideTracker),
+    STATE_FIELD(BattleStruct, unused_6),
+    STATE_FIELD(BattleStruct, givenExpMons),
+    STATE_FIELD(BattleStruct, lastTakenMoveFrom),
+    STATE_FIELD(BattleStruct, castformPalette),
+    STATE_FIELD(BattleStruct, multiBuffer),
+    STATE_FIELD(BattleStruct, wishPerishSongState),
+    STATE_FIELD(BattleStruct, wishPerishSongBattlerId),
+    STATE_FIELD(BattleStruct, overworldWeatherDone),
+    STATE_FIELD(BattleStruct, atkCancelerTracker),
+    STATE_FIELD(BattleStruct, tvMovePoints),
+    STATE_FIELD(BattleStruct, tv),
+    STATE_FIELD(BattleStruct, unused_7),
+    STATE_FIELD(BattleStruct, AI_monToSwitchIntoId),
+    STATE_FIELD(BattleStruct, arenaMindPoints),
+    STATE_FIELD(BattleStruct, arenaSkillPoints),
+    STATE_FIELD(BattleStruct, arenaStartHp),
+    STATE_FIELD(BattleStruct, arenaLostPlayerMons),
+    STATE_FIELD(BattleStruct, arenaLostOpponentMons),
+    STATE_FIELD(BattleStruct, alreadyStatusedMoveAttempt),
+};
+
+#define STATE_BLOCK(name, type, count, fields) {name, sizeof(struct type), count, ARRAY_COUNT(fields), fields}
+#else
+#define STATE_BLOCK(name, type, count, fields) {name, sizeof(struct type), count}
+#endif // STATE_HASH_LOG
+
+static const struct StateBlock sStateBlocks[STATE_BLOCK_COUNT] =
+{
+    [STATE_BLOCK_SAVEBLOCK1]      = STATE_BLOCK("SaveBlock1", SaveBlock1, 1, sSaveBlock1Fields),
+    [STATE_BLOCK_SAVEBLOCK2]      = STATE_BLOCK("SaveBlock2", SaveBlock2, 1, sSaveBlock2Fields),
+    [STATE_BLOCK_POKEMON_STORAGE] = STATE_BLOCK("PokemonStorage", PokemonStorage, 1, sPokemonStorageFields),
+    [STATE_BLOCK_BATTLE_MONS]     = STATE_BLOCK("BattleMons", BattlePokemon, MAX_BATTLERS_COUNT, sBattlePokemonFields),
+    [STATE_BLOCK_BATTLE_STRUCT]   = STATE_BLOCK("BattleStruct", BattleStruct, 1, sBattleStructFields),
+};
+
+static const void *GetStateBlockData(u32 block)
+{
+    switch (block)
+    {
+    case STATE_BLOCK_SAVEBLOCK1:
+        return gSaveBlock1Ptr;
+    case STATE_BLOCK_SAVEBLOCK2:
+        return gSaveBlock2Ptr;
+    case STATE_BLOCK_POKEMON_STORAGE:
+        return gPokemonStoragePtr;
+    case STATE_BLOCK_BATTLE_MONS:
+        return gBattleMons;
+    case STATE_BLOCK_BATTLE_STRUCT:
+        return gBattleStruct; // NULL outside of battle
+    }
+    return NULL;
+}
+
+u32 HashStateData(const void *data, u32 size, u32 hash)
+{
+    const u8 *bytes = data;
+
+    while (size != 0 && ((uintptr_t)bytes & 3) != 0)
+    {
+        hash = (hash ^ *bytes++) * HASH_PRIME;
+        size--;
+    }
+
+    while (size >= 4)
+    {
+        hash = (hash ^ *(const u32 *)bytes) * HASH_PRIME;
+        bytes += 4;
+        size -= 4;
+    }
+
+    while (size != 0)
+    {
+        hash = (hash ^ *bytes++) * HASH_PRIME;
+        size--;
+    }
+
+    return hash;
+}
+
+// Returns 0 for a block that doesn't exist right now, like the battle
+// struct outside of battle.
+u32 GetStateBlockHash(u32 block)
+{
+    const void *data = GetStateBlockData(block);
+
+    if (data == NULL)
+        return 0;
+
+    return HashStateData(data, sStateBlocks[block].size * sStateBlocks[block].count, HASH_OFFSET_BASIS);
+}
+
+u32 GetGameStateHash(void)
+{
+    u32 i;
+    u32 hash = HASH_OFFSET_BASIS;
+
+    for (i = 0; i < STATE_BLOCK_COUNT; i++)
+        hash = (hash ^ GetStateBlockHash(i)) * HASH_PRIME;
+
+    return hash;
+}
+
+#ifdef STATE_HASH_LOG
+
+static u32 GetStateFieldSize(const struct StateBlock *block, u32 field)
+{
+    if (field + 1 < block->fieldCount)
+        return block->fields[field + 1].offset - block->fields[field].offset;
+    else
+        return block->size - block->fields[field].offset;
+}
+
+// The layouts are printed once, for tools/statediff to name the fields by.
+static void LogStateBlockLayout(const struct StateBlock *block)
+{
+    u32 i;
+
+    for (i = 0; i < block->fieldCount; i++)
+    {
+        DebugPrintf("STATEFIELD %s %u %u %u %s",
+                    block->name, i, block->fields[i].offset,
+                    GetStateFieldSize(block, i), block->fields[i].name);
+    }
+}
+
+// Prints the hash of every field of every block that currently exists.
+// tools/statediff compares the logs of two games and names the first
+// field that differs.
+void LogGameStateHashes(const char *event, u32 id)
+{
+    u32 i, element, field, j;
+    u32 hashes[FIELDS_PER_LINE];
+
+    for (i = 0; i < STATE_BLOCK_COUNT; i++)
+    {
+        const struct StateBlock *block = &sStateBlocks[i];
+        const u8 *data = GetStateBlockData(i);
+
+        if (data == NULL)
+            continue;
+
+        if (!(sLayoutsLogged & (1 << i)))
+        {
+            LogStateBlockLayout(block);
+            sLayoutsLogged |= 1 << i;
+        }
+
+        for (element = 0; element < block->count; element++, data += block->size)
+        {
+            for (field = 0; field < block->fieldCount; field += FIELDS_PER_LINE)
+            {
+                for (j = 0; j < FIELDS_PER_LINE; j++)
+                {
+                    if (field + j < block->fieldCount)
+                        hashes[j] = HashStateData(data + block->fields[field + j].offset,
+                                                  GetStateFieldSize(block, field + j),
+                                                  HASH_OFFSET_BASIS);
+                    else
+                        hashes[j] = 0;
+                }
+
+                DebugPrintf("STATEHASH %s %u %s %u %u %08x %08x %08x %08x %08x %08x %08x %08x",
+                            event, id, block->name, element, field,
+                            hashes[0], hashes[1], hashes[2], hashes[3],
+                            hashes[4], hashes[5], hashes[6], hashes[7]);
+            }
+        }
+    }
+}
+
+#endif // STATE_HASH_LOG
+
+#ifdef FRAME_HASH_LOG
+
+EWRAM_DATA static u32 sFrameCount = 0;
+
+// Prints a hash of the state most likely to expose a determinism break
+// after every frame. Each part is printed separately so tools/statediff
+// can say which one diverged first, along with the keys that were held, so
+// a replay that went out of sync can be told apart from a game that did.
+void LogFrameStateHash(void)
+{
+    u32 i;
+    u32 rng, player, party, tasks, sprites;
+
+    rng = HashStateData(&gRngValue, sizeof(gRngValue), HASH_OFFSET_BASIS);
+    rng = HashStateData(&gRng2Value, sizeof(gRng2Value), rng);
+
+    player = HASH_OFFSET_BASIS;
+    if (gSaveBlock1Ptr != NULL)
+    {
+        player = HashStateData(&gSaveBlock1Ptr->pos, sizeof(gSaveBlock1Ptr->pos), player);
+        player = HashStateData(&gSaveBlock1Ptr->location, sizeof(gSaveBlock1Ptr->location), player);
+    }
+
+    party = HashStateData(&gPlayerPartyCount, sizeof(gPlayerPartyCount), HASH_OFFSET_BASIS);
+    party = HashStateData(gPlayerParty, sizeof(gPlayerParty), party);
+
+    // Only which slots are active and their priorities, since those are the
+    // same on any build. Funcs are code addresses, and many tasks keep
+    // pointers in their data.
+    tasks = HASH_OFFSET_BASIS;
+    for (i = 0; i < NUM_TASKS; i++)
+    {
+        if (gTasks[i].isActive)
+        {
+            tasks = (tasks ^ i ^ (gTasks[i].priority << 8)) * HASH_PRIME;
+        #ifdef FRAME_HASH_TASK_DATA
+            tasks = HashStateData(gTasks[i].data, sizeof(gTasks[i].data), tasks);
+        #endif
+        }
+    }
+
+    sprites = HASH_OFFSET_BASIS;
+    for (i = 0; i < MAX_SPRITES; i++)
+    {
+        // x, y, x2 and y2
+        if (gSprites[i].inUse)
+            sprites = HashStateData(&gSprites[i].x, 4 * sizeof(s16), (sprites ^ i) * HASH_PRIME);
+    }
+
+    DebugPrintf("FRAMEHASH %u %04x %08x %08x %08x %08x %08x",
+                sFrameCount++, gMain.heldKeysRaw, rng, player, party, tasks, sprites);
+}
+
+#endif // FRAME_HASH_LOG
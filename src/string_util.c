@@ -9,6 +9,26 @@ EWRAM_DATA u8 gStringVar3[0x100] = {0};
 EWRAM_DATA u8 gStringVar4[0x3E8] = {0};
 EWRAM_DATA static u8 sUnknownStringVar[16] = {0};
 
+// The fast paths below read and write strings a word at a time once the
+// pointers involved are word aligned. That can read up to 3 bytes past EOS,
+// but they are in the same aligned word as EOS, so in the same memory region.
+// The GBA has no memory protection, and an aligned word read can't fault.
+#if MODERN
+typedef u32 __attribute__((may_alias)) StrWord;
+#else
+typedef u32 StrWord;
+#endif
+
+#define IS_WORD_ALIGNED(ptr) (((uintptr_t)(ptr) & 3) == 0)
+#define IS_SAME_WORD_ALIGNMENT(ptr1, ptr2) ((((uintptr_t)(ptr1) ^ (uintptr_t)(ptr2)) & 3) == 0)
+
+// Nonzero if any byte of the word is 0. A byte is EOS (0xFF) exactly when
+// its complement is 0, and it is EXT_CTRL_CODE_BEGIN or above (0xFC-0xFF)
+// exactly when its complement has none of the top 6 bits set.
+#define WORD_HAS_ZERO_BYTE(word) (((word) - 0x01010101) & ~(word) & 0x80808080)
+#define WORD_HAS_EOS(word) WORD_HAS_ZERO_BYTE(~(word))
+#define WORD_HAS_CTRL_CHAR(word) WORD_HAS_ZERO_BYTE(~(word) & 0xFCFCFCFC)
+
 static const u8 sDigits[] = __("0123456789ABCDEF");
 
 static const s32 sPowersOfTen[] =
@@ -72,8 +92,54 @@ u8 *StringCopy_PlayerName(u8 *dest, const u8 *src)
     return &dest[i];
 }
 
+static const u8 *FindEOS(const u8 *str)
+{
+    while (!IS_WORD_ALIGNED(str))
+    {
+        if (*str == EOS)
+            return str;
+        str++;
+    }
+
+    for (;;)
+    {
+        u32 word = *(const StrWord *)str;
+        if (WORD_HAS_EOS(word))
+            break;
+        str += 4;
+    }
+
+    while (*str != EOS)
+        str++;
+
+    return str;
+}
+
 u8 *StringCopy(u8 *dest, const u8 *src)
 {
+    if (IS_SAME_WORD_ALIGNMENT(dest, src))
+    {
+        while (!IS_WORD_ALIGNED(src))
+        {
+            if (*src == EOS)
+            {
+                *dest = EOS;
+                return dest;
+            }
+            *dest++ = *src++;
+        }
+
+        for (;;)
+        {
+            u32 word = *(const StrWord *)src;
+            if (WORD_HAS_EOS(word))
+                break;
+            *(StrWord *)dest = word;
+            dest += 4;
+            src += 4;
+        }
+    }
+
     while (*src != EOS)
     {
         *dest = *src;
@@ -87,10 +153,7 @@ u8 *StringCopy(u8 *dest, const u8 *src)
 
 u8 *StringAppend(u8 *dest, const u8 *src)
 {
-    while (*dest != EOS)
-        dest++;
-
-    return StringCopy(dest, src);
+    return StringCopy((u8 *)FindEOS(dest), src);
 }
 
 u8 *StringCopyN(u8 *dest, const u8 *src, u8 n)
@@ -105,24 +168,38 @@ u8 *StringCopyN(u8 *dest, const u8 *src, u8 n)
 
 u8 *StringAppendN(u8 *dest, const u8 *src, u8 n)
 {
-    while (*dest != EOS)
-        dest++;
-
-    return StringCopyN(dest, src, n);
+    return StringCopyN((u8 *)FindEOS(dest), src, n);
 }
 
 u16 StringLength(const u8 *str)
 {
-    u16 length = 0;
-
-    while (str[length] != EOS)
-        length++;
-
-    return length;
+    return FindEOS(str) - str;
 }
 
 s32 StringCompare(const u8 *str1, const u8 *str2)
 {
+    if (IS_SAME_WORD_ALIGNMENT(str1, str2))
+    {
+        while (!IS_WORD_ALIGNED(str1))
+        {
+            if (*str1 != *str2)
+                return *str1 - *str2;
+            if (*str1 == EOS)
+                return 0;
+            str1++;
+            str2++;
+        }
+
+        for (;;)
+        {
+            u32 word = *(const StrWord *)str1;
+            if (word != *(const StrWord *)str2 || WORD_HAS_EOS(word))
+                break;
+            str1 += 4;
+            str2 += 4;
+        }
+    }
+
     while (*str1 == *str2)
     {
         if (*str1 == EOS)
@@ -136,6 +213,33 @@ s32 StringCompare(const u8 *str1, const u8 *str2)
 
 s32 StringCompareN(const u8 *str1, const u8 *str2, u32 n)
 {
+    if (IS_SAME_WORD_ALIGNMENT(str1, str2))
+    {
+        while (!IS_WORD_ALIGNED(str1))
+        {
+            if (*str1 != *str2)
+                return *str1 - *str2;
+            if (*str1 == EOS)
+                return 0;
+            str1++;
+            str2++;
+            if (--n == 0)
+                return 0;
+        }
+
+        // Only skip whole words that leave at least one byte of n, so the
+        // loop below still decides when n runs out.
+        while (n > 4)
+        {
+            u32 word = *(const StrWord *)str1;
+            if (word != *(const StrWord *)str2 || WORD_HAS_EOS(word))
+                break;
+            str1 += 4;
+            str2 += 4;
+            n -= 4;
+        }
+    }
+
     while (*str1 == *str2)
     {
         if (*str1 == EOS)
@@ -336,10 +440,35 @@ u8 *StringExpandPlaceholders(u8 *dest, const u8 *src)
 {
     for (;;)
     {
-        u8 c = *src++;
+        u8 c;
         u8 placeholderId;
         const u8 *expandedString;
 
+        // Copy the plain text up to the next control character, a word at a
+        // time where dest and src line up.
+        if (IS_SAME_WORD_ALIGNMENT(dest, src))
+        {
+            while (!IS_WORD_ALIGNED(src) && *src < EXT_CTRL_CODE_BEGIN)
+                *dest++ = *src++;
+
+            if (IS_WORD_ALIGNED(src))
+            {
+                for (;;)
+                {
+                    u32 word = *(const StrWord *)src;
+                    if (WORD_HAS_CTRL_CHAR(word))
+                        break;
+                    *(StrWord *)dest = word;
+                    dest += 4;
+                    src += 4;
+                }
+            }
+        }
+
+        while (*src < EXT_CTRL_CODE_BEGIN)
+            *dest++ = *src++;
+
+        c = *src++;
         switch (c)
         {
         case PLACEHOLDER_BEGIN:
@@ -526,10 +655,29 @@ const u8 *GetExpandedPlaceholder(u32 id)
 
 u8 *StringFill(u8 *dest, u8 c, u16 n)
 {
-    u16 i;
+    while (n != 0 && !IS_WORD_ALIGNED(dest))
+    {
+        *dest++ = c;
+        n--;
+    }
 
-    for (i = 0; i < n; i++)
+    if (n >= 4)
+    {
+        u32 word = c * 0x01010101;
+
+        do
+        {
+            *(StrWord *)dest = word;
+            dest += 4;
+            n -= 4;
+        } while (n >= 4);
+    }
+
+    while (n != 0)
+    {
         *dest++ = c;
+        n--;
+    }
 
     *dest = EOS;
     return dest;
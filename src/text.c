@@ -572,7 +572,7 @@ static u8 UNUSED GetLastTextColor(u8 colorType)
 inline static void GLYPH_COPY(u8 *windowTiles, u32 widthOffset, u32 j, u32 i, u32 *glyphPixels, s32 width, s32 height)
 {
     u32 xAdd, yAdd, pixelData, bits, toOrr, dummyX;
-    u8 *dst;
+    u8 *dst, *row;
 
     xAdd = j + width;
     yAdd = i + height;
@@ -580,11 +580,13 @@ inline static void GLYPH_COPY(u8 *windowTiles, u32 widthOffset, u32 j, u32 i, u3
     for (; i < yAdd; i++)
     {
         pixelData = *glyphPixels++;
+        // The row's offset doesn't depend on j, so only compute it once per row
+        row = windowTiles + ((i / 8) * widthOffset) + ((i % 8) * 4);
         for (j = dummyX; j < xAdd; j++)
         {
             if ((toOrr = pixelData & 0xF))
             {
-                dst = windowTiles + ((j / 8) * 32) + ((j % 8) / 2) + ((i / 8) * widthOffset) + ((i % 8) * 4);
+                dst = row + ((j / 8) * 32) + ((j % 8) / 2);
                 bits = ((j & 1) * 4);
                 *dst = (toOrr << bits) | (*dst & (0xF0 >> bits));
             }
@@ -30,13 +30,7 @@ void InitMirageRnd(void)
 
 void UpdateMirageRnd(u16 days)
 {
-    s32 rnd = GetMirageRnd();
-    while (days)
-    {
-        rnd = ISO_RANDOMIZE2(rnd);
-        days--;
-    }
-    SetMirageRnd(rnd);
+    SetMirageRnd(ISO_RANDOMIZE2_N(GetMirageRnd(), days));
 }
 
 bool8 IsMirageIslandPresent(void)
@@ -1,6 +1,12 @@
 #include "global.h"
 #include "trig.h"
 
+extern void SinBatch_ARM(void);
+extern void SinCosBatch_ARM(void);
+extern void TrigBatch_End(void);
+
+static u32 sTrigBatch_Buffer[0x40];
+
 // Values of sin(x*(π/128)) as Q8.8 fixed-point numbers from x = 0 to x = 319
 const s16 gSineTable[] =
 {
@@ -511,6 +517,269 @@ const s16 gSineDegreeTable[] =
     Q_4_12(0.017333984375), // sin(179°)
 };
 
+// values of sin(x*(π/512)) as Q4.12 fixed-point numbers from x = 0 to x = 256
+// (one quarter turn), used by the interpolating SinFine and CosFine
+const s16 gSineFineTable[] =
+{
+    Q_4_12(0),              // sin(0*(π/512))
+    Q_4_12(0.006103515625), // sin(1*(π/512))
+    Q_4_12(0.01220703125),  // sin(2*(π/512))
+    Q_4_12(0.018310546875), // sin(3*(π/512))
+    Q_4_12(0.024658203125), // sin(4*(π/512))
+    Q_4_12(0.03076171875),  // sin(5*(π/512))
+    Q_4_12(0.036865234375), // sin(6*(π/512))
+    Q_4_12(0.04296875),     // sin(7*(π/512))
+    Q_4_12(0.049072265625), // sin(8*(π/512))
+    Q_4_12(0.05517578125),  // sin(9*(π/512))
+    Q_4_12(0.061279296875), // sin(10*(π/512))
+    Q_4_12(0.0673828125),   // sin(11*(π/512))
+    Q_4_12(0.073486328125), // sin(12*(π/512))
+    Q_4_12(0.07958984375),  // sin(13*(π/512))
+    Q_4_12(0.085693359375), // sin(14*(π/512))
+    Q_4_12(0.091796875),    // sin(15*(π/512))
+    Q_4_12(0.097900390625), // sin(16*(π/512))
+    Q_4_12(0.10400390625),  // sin(17*(π/512))
+    Q_4_12(0.110107421875), // sin(18*(π/512))
+    Q_4_12(0.1162109375),   // sin(19*(π/512))
+    Q_4_12(0.122314453125), // sin(20*(π/512))
+    Q_4_12(0.12841796875),  // sin(21*(π/512))
+    Q_4_12(0.134521484375), // sin(22*(π/512))
+    Q_4_12(0.140625),       // sin(23*(π/512))
+    Q_4_12(0.146728515625), // sin(24*(π/512))
+    Q_4_12(0.15283203125),  // sin(25*(π/512))
+    Q_4_12(0.158935546875), // sin(26*(π/512))
+    Q_4_12(0.164794921875), // sin(27*(π/512))
+    Q_4_12(0.1708984375),   // sin(28*(π/512))
+    Q_4_12(0.177001953125), // sin(29*(π/512))
+    Q_4_12(0.18310546875),  // sin(30*(π/512))
+    Q_4_12(0.18896484375),  // sin(31*(π/512))
+    Q_4_12(0.195068359375), // sin(32*(π/512))
+    Q_4_12(0.201171875),    // sin(33*(π/512))
+    Q_4_12(0.20703125),     // sin(34*(π/512))
+    Q_4_12(0.213134765625), // sin(35*(π/512))
+    Q_4_12(0.218994140625), // sin(36*(π/512))
+    Q_4_12(0.22509765625),  // sin(37*(π/512))
+    Q_4_12(0.23095703125),  // sin(38*(π/512))
+    Q_4_12(0.237060546875), // sin(39*(π/512))
+    Q_4_12(0.242919921875), // sin(40*(π/512))
+    Q_4_12(0.2490234375),   // sin(41*(π/512))
+    Q_4_12(0.2548828125),   // sin(42*(π/512))
+    Q_4_12(0.2607421875),   // sin(43*(π/512))
+    Q_4_12(0.2666015625),   // sin(44*(π/512))
+    Q_4_12(0.272705078125), // sin(45*(π/512))
+    Q_4_12(0.278564453125), // sin(46*(π/512))
+    Q_4_12(0.284423828125), // sin(47*(π/512))
+    Q_4_12(0.290283203125), // sin(48*(π/512))
+    Q_4_12(0.296142578125), // sin(49*(π/512))
+    Q_4_12(0.302001953125), // sin(50*(π/512))
+    Q_4_12(0.307861328125), // sin(51*(π/512))
+    Q_4_12(0.313720703125), // sin(52*(π/512))
+    Q_4_12(0.319580078125), // sin(53*(π/512))
+    Q_4_12(0.3251953125),   // sin(54*(π/512))
+    Q_4_12(0.3310546875),   // sin(55*(π/512))
+    Q_4_12(0.3369140625),   // sin(56*(π/512))
+    Q_4_12(0.3427734375),   // sin(57*(π/512))
+    Q_4_12(0.348388671875), // sin(58*(π/512))
+    Q_4_12(0.354248046875), // sin(59*(π/512))
+    Q_4_12(0.35986328125),  // sin(60*(π/512))
+    Q_4_12(0.36572265625),  // sin(61*(π/512))
+    Q_4_12(0.371337890625), // sin(62*(π/512))
+    Q_4_12(0.376953125),    // sin(63*(π/512))
+    Q_4_12(0.382568359375), // sin(64*(π/512))
+    Q_4_12(0.388427734375), // sin(65*(π/512))
+    Q_4_12(0.39404296875),  // sin(66*(π/512))
+    Q_4_12(0.399658203125), // sin(67*(π/512))
+    Q_4_12(0.4052734375),   // sin(68*(π/512))
+    Q_4_12(0.410888671875), // sin(69*(π/512))
+    Q_4_12(0.41650390625),  // sin(70*(π/512))
+    Q_4_12(0.422119140625), // sin(71*(π/512))
+    Q_4_12(0.427490234375), // sin(72*(π/512))
+    Q_4_12(0.43310546875),  // sin(73*(π/512))
+    Q_4_12(0.438720703125), // sin(74*(π/512))
+    Q_4_12(0.444091796875), // sin(75*(π/512))
+    Q_4_12(0.44970703125),  // sin(76*(π/512))
+    Q_4_12(0.455078125),    // sin(77*(π/512))
+    Q_4_12(0.46044921875),  // sin(78*(π/512))
+    Q_4_12(0.466064453125), // sin(79*(π/512))
+    Q_4_12(0.471435546875), // sin(80*(π/512))
+    Q_4_12(0.476806640625), // sin(81*(π/512))
+    Q_4_12(0.482177734375), // sin(82*(π/512))
+    Q_4_12(0.487548828125), // sin(83*(π/512))
+    Q_4_12(0.492919921875), // sin(84*(π/512))
+    Q_4_12(0.498291015625), // sin(85*(π/512))
+    Q_4_12(0.50341796875),  // sin(86*(π/512))
+    Q_4_12(0.5087890625),   // sin(87*(π/512))
+    Q_4_12(0.51416015625),  // sin(88*(π/512))
+    Q_4_12(0.519287109375), // sin(89*(π/512))
+    Q_4_12(0.524658203125), // sin(90*(π/512))
+    Q_4_12(0.52978515625),  // sin(91*(π/512))
+    Q_4_12(0.534912109375), // sin(92*(π/512))
+    Q_4_12(0.540283203125), // sin(93*(π/512))
+    Q_4_12(0.54541015625),  // sin(94*(π/512))
+    Q_4_12(0.550537109375), // sin(95*(π/512))
+    Q_4_12(0.5556640625),   // sin(96*(π/512))
+    Q_4_12(0.560546875),    // sin(97*(π/512))
+    Q_4_12(0.565673828125), // sin(98*(π/512))
+    Q_4_12(0.57080078125),  // sin(99*(π/512))
+    Q_4_12(0.575927734375), // sin(100*(π/512))
+    Q_4_12(0.580810546875), // sin(101*(π/512))
+    Q_4_12(0.585693359375), // sin(102*(π/512))
+    Q_4_12(0.5908203125),   // sin(103*(π/512))
+    Q_4_12(0.595703125),    // sin(104*(π/512))
+    Q_4_12(0.6005859375),   // sin(105*(π/512))
+    Q_4_12(0.60546875),     // sin(106*(π/512))
+    Q_4_12(0.6103515625),   // sin(107*(π/512))
+    Q_4_12(0.615234375),    // sin(108*(π/512))
+    Q_4_12(0.6201171875),   // sin(109*(π/512))
+    Q_4_12(0.624755859375), // sin(110*(π/512))
+    Q_4_12(0.629638671875), // sin(111*(π/512))
+    Q_4_12(0.63427734375),  // sin(112*(π/512))
+    Q_4_12(0.63916015625),  // sin(113*(π/512))
+    Q_4_12(0.643798828125), // sin(114*(π/512))
+    Q_4_12(0.6484375),      // sin(115*(π/512))
+    Q_4_12(0.653076171875), // sin(116*(π/512))
+    Q_4_12(0.65771484375),  // sin(117*(π/512))
+    Q_4_12(0.662353515625), // sin(118*(π/512))
+    Q_4_12(0.6669921875),   // sin(119*(π/512))
+    Q_4_12(0.671630859375), // sin(120*(π/512))
+    Q_4_12(0.676025390625), // sin(121*(π/512))
+    Q_4_12(0.6806640625),   // sin(122*(π/512))
+    Q_4_12(0.68505859375),  // sin(123*(π/512))
+    Q_4_12(0.689453125),    // sin(124*(π/512))
+    Q_4_12(0.694091796875), // sin(125*(π/512))
+    Q_4_12(0.698486328125), // sin(126*(π/512))
+    Q_4_12(0.70263671875),  // sin(127*(π/512))
+    Q_4_12(0.70703125),     // sin(128*(π/512))
+    Q_4_12(0.71142578125),  // sin(129*(π/512))
+    Q_4_12(0.7158203125),   // sin(130*(π/512))
+    Q_4_12(0.719970703125), // sin(131*(π/512))
+    Q_4_12(0.724365234375), // sin(132*(π/512))
+    Q_4_12(0.728515625),    // sin(133*(π/512))
+    Q_4_12(0.732666015625), // sin(134*(π/512))
+    Q_4_12(0.73681640625),  // sin(135*(π/512))
+    Q_4_12(0.740966796875), // sin(136*(π/512))
+    Q_4_12(0.7451171875),   // sin(137*(π/512))
+    Q_4_12(0.7490234375),   // sin(138*(π/512))
+    Q_4_12(0.753173828125), // sin(139*(π/512))
+    Q_4_12(0.75732421875),  // sin(140*(π/512))
+    Q_4_12(0.76123046875),  // sin(141*(π/512))
+    Q_4_12(0.76513671875),  // sin(142*(π/512))
+    Q_4_12(0.76904296875),  // sin(143*(π/512))
+    Q_4_12(0.77294921875),  // sin(144*(π/512))
+    Q_4_12(0.77685546875),  // sin(145*(π/512))
+    Q_4_12(0.78076171875),  // sin(146*(π/512))
+    Q_4_12(0.78466796875),  // sin(147*(π/512))
+    Q_4_12(0.788330078125), // sin(148*(π/512))
+    Q_4_12(0.7919921875),   // sin(149*(π/512))
+    Q_4_12(0.7958984375),   // sin(150*(π/512))
+    Q_4_12(0.799560546875), // sin(151*(π/512))
+    Q_4_12(0.80322265625),  // sin(152*(π/512))
+    Q_4_12(0.806884765625), // sin(153*(π/512))
+    Q_4_12(0.810546875),    // sin(154*(π/512))
+    Q_4_12(0.81396484375),  // sin(155*(π/512))
+    Q_4_12(0.817626953125), // sin(156*(π/512))
+    Q_4_12(0.821044921875), // sin(157*(π/512))
+    Q_4_12(0.82470703125),  // sin(158*(π/512))
+    Q_4_12(0.828125),       // sin(159*(π/512))
+    Q_4_12(0.83154296875),  // sin(160*(π/512))
+    Q_4_12(0.8349609375),   // sin(161*(π/512))
+    Q_4_12(0.838134765625), // sin(162*(π/512))
+    Q_4_12(0.841552734375), // sin(163*(π/512))
+    Q_4_12(0.844970703125), // sin(164*(π/512))
+    Q_4_12(0.84814453125),  // sin(165*(π/512))
+    Q_4_12(0.851318359375), // sin(166*(π/512))
+    Q_4_12(0.8544921875),   // sin(167*(π/512))
+    Q_4_12(0.857666015625), // sin(168*(π/512))
+    Q_4_12(0.86083984375),  // sin(169*(π/512))
+    Q_4_12(0.864013671875), // sin(170*(π/512))
+    Q_4_12(0.866943359375), // sin(171*(π/512))
+    Q_4_12(0.8701171875),   // sin(172*(π/512))
+    Q_4_12(0.873046875),    // sin(173*(π/512))
+    Q_4_12(0.8759765625),   // sin(174*(π/512))
+    Q_4_12(0.87890625),     // sin(175*(π/512))
+    Q_4_12(0.8818359375),   // sin(176*(π/512))
+    Q_4_12(0.884765625),    // sin(177*(π/512))
+    Q_4_12(0.8876953125),   // sin(178*(π/512))
+    Q_4_12(0.890380859375), // sin(179*(π/512))
+    Q_4_12(0.893310546875), // sin(180*(π/512))
+    Q_4_12(0.89599609375),  // sin(181*(π/512))
+    Q_4_12(0.898681640625), // sin(182*(π/512))
+    Q_4_12(0.9013671875),   // sin(183*(π/512))
+    Q_4_12(0.904052734375), // sin(184*(π/512))
+    Q_4_12(0.906494140625), // sin(185*(π/512))
+    Q_4_12(0.9091796875),   // sin(186*(π/512))
+    Q_4_12(0.91162109375),  // sin(187*(π/512))
+    Q_4_12(0.914306640625), // sin(188*(π/512))
+    Q_4_12(0.916748046875), // sin(189*(π/512))
+    Q_4_12(0.919189453125), // sin(190*(π/512))
+    Q_4_12(0.921630859375), // sin(191*(π/512))
+    Q_4_12(0.923828125),    // sin(192*(π/512))
+    Q_4_12(0.92626953125),  // sin(193*(π/512))
+    Q_4_12(0.928466796875), // sin(194*(π/512))
+    Q_4_12(0.9306640625),   // sin(195*(π/512))
+    Q_4_12(0.93310546875),  // sin(196*(π/512))
+    Q_4_12(0.935302734375), // sin(197*(π/512))
+    Q_4_12(0.937255859375), // sin(198*(π/512))
+    Q_4_12(0.939453125),    // sin(199*(π/512))
+    Q_4_12(0.941650390625), // sin(200*(π/512))
+    Q_4_12(0.943603515625), // sin(201*(π/512))
+    Q_4_12(0.945556640625), // sin(202*(π/512))
+    Q_4_12(0.947509765625), // sin(203*(π/512))
+    Q_4_12(0.949462890625), // sin(204*(π/512))
+    Q_4_12(0.951416015625), // sin(205*(π/512))
+    Q_4_12(0.953369140625), // sin(206*(π/512))
+    Q_4_12(0.955078125),    // sin(207*(π/512))
+    Q_4_12(0.95703125),     // sin(208*(π/512))
+    Q_4_12(0.958740234375), // sin(209*(π/512))
+    Q_4_12(0.96044921875),  // sin(210*(π/512))
+    Q_4_12(0.962158203125), // sin(211*(π/512))
+    Q_4_12(0.9638671875),   // sin(212*(π/512))
+    Q_4_12(0.96533203125),  // sin(213*(π/512))
+    Q_4_12(0.967041015625), // sin(214*(π/512))
+    Q_4_12(0.968505859375), // sin(215*(π/512))
+    Q_4_12(0.969970703125), // sin(216*(π/512))
+    Q_4_12(0.971435546875), // sin(217*(π/512))
+    Q_4_12(0.972900390625), // sin(218*(π/512))
+    Q_4_12(0.974365234375), // sin(219*(π/512))
+    Q_4_12(0.9755859375),   // sin(220*(π/512))
+    Q_4_12(0.97705078125),  // sin(221*(π/512))
+    Q_4_12(0.978271484375), // sin(222*(π/512))
+    Q_4_12(0.9794921875),   // sin(223*(π/512))
+    Q_4_12(0.980712890625), // sin(224*(π/512))
+    Q_4_12(0.98193359375),  // sin(225*(π/512))
+    Q_4_12(0.983154296875), // sin(226*(π/512))
+    Q_4_12(0.984130859375), // sin(227*(π/512))
+    Q_4_12(0.9853515625),   // sin(228*(π/512))
+    Q_4_12(0.986328125),    // sin(229*(π/512))
+    Q_4_12(0.9873046875),   // sin(230*(π/512))
+    Q_4_12(0.98828125),     // sin(231*(π/512))
+    Q_4_12(0.9892578125),   // sin(232*(π/512))
+    Q_4_12(0.989990234375), // sin(233*(π/512))
+    Q_4_12(0.990966796875), // sin(234*(π/512))
+    Q_4_12(0.99169921875),  // sin(235*(π/512))
+    Q_4_12(0.992431640625), // sin(236*(π/512))
+    Q_4_12(0.9931640625),   // sin(237*(π/512))
+    Q_4_12(0.993896484375), // sin(238*(π/512))
+    Q_4_12(0.99462890625),  // sin(239*(π/512))
+    Q_4_12(0.9951171875),   // sin(240*(π/512))
+    Q_4_12(0.995849609375), // sin(241*(π/512))
+    Q_4_12(0.996337890625), // sin(242*(π/512))
+    Q_4_12(0.996826171875), // sin(243*(π/512))
+    Q_4_12(0.997314453125), // sin(244*(π/512))
+    Q_4_12(0.997802734375), // sin(245*(π/512))
+    Q_4_12(0.998046875),    // sin(246*(π/512))
+    Q_4_12(0.99853515625),  // sin(247*(π/512))
+    Q_4_12(0.998779296875), // sin(248*(π/512))
+    Q_4_12(0.9990234375),   // sin(249*(π/512))
+    Q_4_12(0.999267578125), // sin(250*(π/512))
+    Q_4_12(0.99951171875),  // sin(251*(π/512))
+    Q_4_12(0.999755859375), // sin(252*(π/512))
+    Q_4_12(0.999755859375), // sin(253*(π/512))
+    Q_4_12(0.999755859375), // sin(254*(π/512))
+    Q_4_12(0.999755859375), // sin(255*(π/512))
+    Q_4_12(1),              // sin(256*(π/512))
+};
+
 // amplitude * sin(index*(π/128))
 s16 Sin(s16 index, s16 amplitude)
 {
@@ -541,3 +810,113 @@ s16 Cos2(u16 angle)
 {
     return Sin2(angle + 90);
 }
+
+// Q4.12 sine of a quarter-turn position from 0 to 0x4000, interpolated
+// linearly between the 256 steps of gSineFineTable.
+static s32 SinFineQuarter(u32 pos)
+{
+    u32 index = pos >> 6;
+    s32 frac = pos & 0x3F;
+    s32 value = gSineFineTable[index];
+
+    if (frac != 0)
+        value += ((gSineFineTable[index + 1] - value) * frac) >> 6;
+    return value;
+}
+
+// Q4.12 sin(angle), where an angle of 0x10000 is a full turn
+s16 SinFine(u16 angle)
+{
+    u32 pos = angle & 0x3FFF;
+    s32 value;
+
+    if (angle & 0x4000)
+        pos = 0x4000 - pos;
+    value = SinFineQuarter(pos);
+
+    if (angle & 0x8000)
+        return -value;
+    else
+        return value;
+}
+
+// Q4.12 cos(angle), where an angle of 0x10000 is a full turn
+s16 CosFine(u16 angle)
+{
+    return SinFine(angle + 0x4000);
+}
+
+// Both SinFine(angle) and CosFine(angle), sharing the two table lookups
+void SinCosFine(u16 angle, s16 *sin, s16 *cos)
+{
+    u32 pos = angle & 0x3FFF;
+    s32 a = SinFineQuarter(pos);
+    s32 b = SinFineQuarter(0x4000 - pos);
+
+    switch (angle >> 14)
+    {
+    case 0:
+        *sin = a;
+        *cos = b;
+        break;
+    case 1:
+        *sin = b;
+        *cos = -a;
+        break;
+    case 2:
+        *sin = -a;
+        *cos = -b;
+        break;
+    default:
+        *sin = -b;
+        *cos = a;
+        break;
+    }
+}
+
+// The batch functions below are ARM code in trig_batch.s, which
+// InitTrigBatchFuncs copies to IWRAM. Indexes and steps are Q8.8 indexes
+// into gSineTable, so a step of 0x100 matches calling Sin once per index.
+void InitTrigBatchFuncs(void)
+{
+    CpuCopy32((void *)SinBatch_ARM, sTrigBatch_Buffer, (uintptr_t)TrigBatch_End - (uintptr_t)SinBatch_ARM);
+}
+
+// dest[i] = Sin((index + i * step) >> 8, amplitude)
+void SinBatch(s16 *dest, u32 count, u16 index, u16 step, s16 amplitude)
+{
+    ((void (*)(s16 *, u32, u32, u32, s32))sTrigBatch_Buffer)(dest, count, index, step, amplitude);
+}
+
+// dest[2 * i] = Sin(n, amplitude), dest[2 * i + 1] = Cos(n, amplitude)
+// for n = (index + i * step) >> 8, e.g. to fill rows of affine matrices.
+void SinCosBatch(s16 *dest, u32 count, u16 index, u16 step, s16 amplitude)
+{
+    u32 offset = (uintptr_t)SinCosBatch_ARM - (uintptr_t)SinBatch_ARM;
+
+    ((void (*)(s16 *, u32, u32, u32, s32))((u8 *)sTrigBatch_Buffer + offset))(dest, count, index, step, amplitude);
+}
+
+// C versions of the routines in trig_batch.s, written the same way step for
+// step. They're what the ARM code is reviewed against, and what the host
+// math test checks against Sin and Cos, since the ARM code can't run there.
+void SinBatch_C(s16 *dest, u32 count, u16 index, u16 step, s16 amplitude)
+{
+    while (count-- != 0)
+    {
+        *dest++ = (amplitude * gSineTable[index >> 8]) >> 8;
+        index += step;
+    }
+}
+
+void SinCosBatch_C(s16 *dest, u32 count, u16 index, u16 step, s16 amplitude)
+{
+    while (count-- != 0)
+    {
+        const s16 *sine = &gSineTable[index >> 8];
+
+        *dest++ = (amplitude * sine[0]) >> 8;
+        *dest++ = (amplitude * sine[64]) >> 8;
+        index += step;
+    }
+}
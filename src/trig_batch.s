@@ -0,0 +1,63 @@
+	.include "asm/macros.inc"
+
+	.syntax unified
+
+	.text
+
+@ Everything from SinBatch_ARM to TrigBatch_End, including the literal pool,
+@ is copied to IWRAM by InitTrigBatchFuncs and called from there.
+
+@ r0 = dest, r1 = count, r2 = Q8.8 index, r3 = Q8.8 step, [sp] = amplitude
+	arm_func_start SinBatch_ARM
+SinBatch_ARM:
+	ldr r12, [sp]
+	stmfd sp!, {r4, r5, lr}
+	ldr r4, =gSineTable
+SinBatch_Loop:
+	subs r1, r1, #1
+	bmi SinBatch_Done
+	and r5, r2, #0xFF00
+	mov r5, r5, lsr #7
+	ldrsh r5, [r4, r5]
+	mul r5, r12, r5
+	mov r5, r5, asr #8
+	strh r5, [r0], #2
+	add r2, r2, r3
+	b SinBatch_Loop
+SinBatch_Done:
+	ldmfd sp!, {r4, r5, lr}
+	bx lr
+	arm_func_end SinBatch_ARM
+
+@ Same arguments as SinBatch_ARM, but writes a sine and cosine pair per step.
+	arm_func_start SinCosBatch_ARM
+SinCosBatch_ARM:
+	ldr r12, [sp]
+	stmfd sp!, {r4-r6, lr}
+	ldr r4, =gSineTable
+SinCosBatch_Loop:
+	subs r1, r1, #1
+	bmi SinCosBatch_Done
+	and r5, r2, #0xFF00
+	add r5, r4, r5, lsr #7
+	ldrsh r6, [r5]
+	mul r6, r12, r6
+	mov r6, r6, asr #8
+	strh r6, [r0], #2
+	ldrsh r6, [r5, #128]
+	mul r6, r12, r6
+	mov r6, r6, asr #8
+	strh r6, [r0], #2
+	add r2, r2, r3
+	b SinCosBatch_Loop
+SinCosBatch_Done:
+	ldmfd sp!, {r4-r6, lr}
+	bx lr
+	arm_func_end SinCosBatch_ARM
+
+	.pool
+
+	.global TrigBatch_End
+TrigBatch_End:
+
+	.align 2, 0 @ Don't pad with nop.
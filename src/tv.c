@@ -111,7 +111,7 @@ static void SetMixedTVShows(TVShow *, TVShow *, TVShow *, TVShow *);
 static void DeleteExcessMixedShows(void);
 static void DeactivateShowsWithUnseenSpecies(void);
 static void DeactivateGameCompleteShowsIfNotUnlocked(void);
-static s8 FindInactiveShowInArray(TVShow *);
+static s8 FindInactiveShowInArray(TVShow *, u8);
 static bool8 TryMixTVShow(TVShow *[], TVShow *[], u8);
 static bool8 TryMixNormalTVShow(TVShow *, TVShow *, u8);
 static bool8 TryMixRecordMixTVShow(TVShow *, TVShow *, u8);
@@ -3495,17 +3495,56 @@ void ReceiveTvShowsData(void *src, u32 size, u8 playersLinkId)
     }
 }
 
+// Returns a bit for each empty Record Mix slot, see FindFirstEmptyRecordMixTVShowSlot
+static u32 GetEmptyRecordMixTVShowSlots(TVShow *shows)
+{
+    u8 i;
+    u32 slots = 0;
+
+    for (i = NUM_NORMAL_TVSHOW_SLOTS; i < LAST_TVSHOW_IDX; i++)
+    {
+        if (shows[i].common.kind == TVSHOW_OFF_AIR)
+            slots |= 1 << i;
+    }
+    return slots;
+}
+
+static s8 GetFirstSlotInMask(u32 slots)
+{
+    s8 i;
+
+    if (slots == 0)
+        return -1;
+    for (i = 0; !(slots & (1 << i)); i++)
+        ;
+    return i;
+}
+
+// Each player's shows are scanned once. Mixing never creates inactive shows,
+// so the search for the next show to share resumes where the last one was
+// found. The empty Record Mix slots of each player are tracked as a bitmask.
+// The result is identical to searching the arrays again for every show, which
+// is what the other games in the link still do.
 static void SetMixedTVShows(TVShow player1[TV_SHOWS_COUNT], TVShow player2[TV_SHOWS_COUNT], TVShow player3[TV_SHOWS_COUNT], TVShow player4[TV_SHOWS_COUNT])
 {
     u8 i;
     u8 j;
+    u8 dest;
     TVShow **tvShows[MAX_LINK_PLAYERS];
+    u8 nextInactiveShow[MAX_LINK_PLAYERS];
+    u32 emptySlots[MAX_LINK_PLAYERS];
 
     tvShows[0] = &player1;
     tvShows[1] = &player2;
     tvShows[2] = &player3;
     tvShows[3] = &player4;
     sTVShowMixingNumPlayers = GetLinkPlayerCount();
+    for (i = 0; i < sTVShowMixingNumPlayers; i++)
+    {
+        nextInactiveShow[i] = 0;
+        emptySlots[i] = GetEmptyRecordMixTVShowSlots(tvShows[i][0]);
+    }
+
     while (1)
     {
         for (i = 0; i < sTVShowMixingNumPlayers; i++)
@@ -3513,24 +3552,34 @@ static void SetMixedTVShows(TVShow player1[TV_SHOWS_COUNT], TVShow player2[TV_SH
             if (i == 0)
                 sRecordMixingPartnersWithoutShowsToShare = 0;
 
-            sTVShowMixingCurSlot = FindInactiveShowInArray(tvShows[i][0]);
+            sTVShowMixingCurSlot = FindInactiveShowInArray(tvShows[i][0], nextInactiveShow[i]);
             if (sTVShowMixingCurSlot == -1)
             {
+                nextInactiveShow[i] = LAST_TVSHOW_IDX;
                 sRecordMixingPartnersWithoutShowsToShare++;
                 if (sRecordMixingPartnersWithoutShowsToShare == sTVShowMixingNumPlayers)
                     return;
             }
             else
             {
+                nextInactiveShow[i] = sTVShowMixingCurSlot;
                 for (j = 0; j < sTVShowMixingNumPlayers - 1; j++)
                 {
-                    sCurTVShowSlot = FindFirstEmptyRecordMixTVShowSlot(tvShows[(i + j + 1) % sTVShowMixingNumPlayers][0]);
+                    dest = (i + j + 1) % sTVShowMixingNumPlayers;
+                    sCurTVShowSlot = GetFirstSlotInMask(emptySlots[dest]);
                     if (sCurTVShowSlot != -1
-                        && TryMixTVShow(&tvShows[(i + j + 1) % sTVShowMixingNumPlayers][0], &tvShows[i][0], (i + j + 1) % sTVShowMixingNumPlayers) == 1)
+                        && TryMixTVShow(&tvShows[dest][0], &tvShows[i][0], dest) == 1)
+                    {
+                        emptySlots[dest] &= ~(1 << sCurTVShowSlot);
                         break;
+                    }
                 }
                 if (j == sTVShowMixingNumPlayers - 1)
                     DeleteTVShowInArrayByIdx(tvShows[i][0], sTVShowMixingCurSlot);
+
+                // The shared show was removed either way
+                if (sTVShowMixingCurSlot >= NUM_NORMAL_TVSHOW_SLOTS)
+                    emptySlots[i] |= 1 << sTVShowMixingCurSlot;
             }
         }
     }
@@ -3623,11 +3672,11 @@ static bool8 TryMixOutbreakTVShow(TVShow *dest, TVShow *src, u8 idx)
     return TRUE;
 }
 
-static s8 FindInactiveShowInArray(TVShow *tvShows)
+static s8 FindInactiveShowInArray(TVShow *tvShows, u8 start)
 {
     u8 i;
 
-    for (i = 0; i < LAST_TVSHOW_IDX; i++)
+    for (i = start; i < LAST_TVSHOW_IDX; i++)
     {
         // Second check is to make sure its a valid show (not too high, not TVSHOW_OFF_AIR)
         if (tvShows[i].common.active == FALSE && (u8)(tvShows[i].common.kind - 1) < TVGROUP_OUTBREAK_END)
@@ -47,6 +47,9 @@ enum {
 
 #define HEADER_NONE 0xFFFF
 
+// Nonzero for every map, so a zeroed cache never matches.
+#define MAP_HEADER_KEY(mapGroup, mapNum) ((((mapGroup) << 8) | (mapNum)) + 1)
+
 static u16 FeebasRandom(void);
 static void FeebasSeedRng(u16 seed);
 static bool8 IsWildLevelAllowedByRepel(u8 level);
@@ -61,9 +64,19 @@ static bool8 IsAbilityAllowingEncounter(u8 level);
 
 EWRAM_DATA static u8 sWildEncountersDisabled = 0;
 EWRAM_DATA static u32 sFeebasRngValue = 0;
+EWRAM_DATA static u16 sCachedWildMonHeaderMapKey = 0;
+EWRAM_DATA static u16 sCachedWildMonHeaderId = 0;
 
 #include "data/wild_encounters.h"
 
+// The wild mon slot for every roll of Random() % ENCOUNTER_CHANCE_*_TOTAL,
+// generated from the encounter rates in wild_encounters.json.
+static const u8 sLandMonSlotByRoll[ENCOUNTER_CHANCE_LAND_MONS_TOTAL] = ENCOUNTER_SLOTS_LAND_MONS;
+static const u8 sWaterMonSlotByRoll[ENCOUNTER_CHANCE_WATER_MONS_TOTAL] = ENCOUNTER_SLOTS_WATER_MONS;
+static const u8 sOldRodSlotByRoll[ENCOUNTER_CHANCE_FISHING_MONS_OLD_ROD_TOTAL] = ENCOUNTER_SLOTS_FISHING_MONS_OLD_ROD;
+static const u8 sGoodRodSlotByRoll[ENCOUNTER_CHANCE_FISHING_MONS_GOOD_ROD_TOTAL] = ENCOUNTER_SLOTS_FISHING_MONS_GOOD_ROD;
+static const u8 sSuperRodSlotByRoll[ENCOUNTER_CHANCE_FISHING_MONS_SUPER_ROD_TOTAL] = ENCOUNTER_SLOTS_FISHING_MONS_SUPER_ROD;
+
 static const struct WildPokemon sWildFeebas = {20, 25, SPECIES_FEEBAS};
 
 static const u16 sRoute119WaterTileData[] =
@@ -181,49 +194,13 @@ static void FeebasSeedRng(u16 seed)
 // LAND_WILD_COUNT
 static u8 ChooseWildMonIndex_Land(void)
 {
-    u8 rand = Random() % ENCOUNTER_CHANCE_LAND_MONS_TOTAL;
-
-    if (rand < ENCOUNTER_CHANCE_LAND_MONS_SLOT_0)
-        return 0;
-    else if (rand >= ENCOUNTER_CHANCE_LAND_MONS_SLOT_0 && rand < ENCOUNTER_CHANCE_LAND_MONS_SLOT_1)
-        return 1;
-    else if (rand >= ENCOUNTER_CHANCE_LAND_MONS_SLOT_1 && rand < ENCOUNTER_CHANCE_LAND_MONS_SLOT_2)
-        return 2;
-    else if (rand >= ENCOUNTER_CHANCE_LAND_MONS_SLOT_2 && rand < ENCOUNTER_CHANCE_LAND_MONS_SLOT_3)
-        return 3;
-    else if (rand >= ENCOUNTER_CHANCE_LAND_MONS_SLOT_3 && rand < ENCOUNTER_CHANCE_LAND_MONS_SLOT_4)
-        return 4;
-    else if (rand >= ENCOUNTER_CHANCE_LAND_MONS_SLOT_4 && rand < ENCOUNTER_CHANCE_LAND_MONS_SLOT_5)
-        return 5;
-    else if (rand >= ENCOUNTER_CHANCE_LAND_MONS_SLOT_5 && rand < ENCOUNTER_CHANCE_LAND_MONS_SLOT_6)
-        return 6;
-    else if (rand >= ENCOUNTER_CHANCE_LAND_MONS_SLOT_6 && rand < ENCOUNTER_CHANCE_LAND_MONS_SLOT_7)
-        return 7;
-    else if (rand >= ENCOUNTER_CHANCE_LAND_MONS_SLOT_7 && rand < ENCOUNTER_CHANCE_LAND_MONS_SLOT_8)
-        return 8;
-    else if (rand >= ENCOUNTER_CHANCE_LAND_MONS_SLOT_8 && rand < ENCOUNTER_CHANCE_LAND_MONS_SLOT_9)
-        return 9;
-    else if (rand >= ENCOUNTER_CHANCE_LAND_MONS_SLOT_9 && rand < ENCOUNTER_CHANCE_LAND_MONS_SLOT_10)
-        return 10;
-    else
-        return 11;
+    return sLandMonSlotByRoll[Random() % ENCOUNTER_CHANCE_LAND_MONS_TOTAL];
 }
 
 // ROCK_WILD_COUNT / WATER_WILD_COUNT
 static u8 ChooseWildMonIndex_WaterRock(void)
 {
-    u8 rand = Random() % ENCOUNTER_CHANCE_WATER_MONS_TOTAL;
-
-    if (rand < ENCOUNTER_CHANCE_WATER_MONS_SLOT_0)
-        return 0;
-    else if (rand >= ENCOUNTER_CHANCE_WATER_MONS_SLOT_0 && rand < ENCOUNTER_CHANCE_WATER_MONS_SLOT_1)
-        return 1;
-    else if (rand >= ENCOUNTER_CHANCE_WATER_MONS_SLOT_1 && rand < ENCOUNTER_CHANCE_WATER_MONS_SLOT_2)
-        return 2;
-    else if (rand >= ENCOUNTER_CHANCE_WATER_MONS_SLOT_2 && rand < ENCOUNTER_CHANCE_WATER_MONS_SLOT_3)
-        return 3;
-    else
-        return 4;
+    return sWaterMonSlotByRoll[Random() % ENCOUNTER_CHANCE_WATER_MONS_TOTAL];
 }
 
 // FISH_WILD_COUNT
@@ -233,33 +210,23 @@ static u8 ChooseWildMonIndex_Fishing(u8 rod)
     u8 rand = Random() % max(max(ENCOUNTER_CHANCE_FISHING_MONS_OLD_ROD_TOTAL, ENCOUNTER_CHANCE_FISHING_MONS_GOOD_ROD_TOTAL),
                              ENCOUNTER_CHANCE_FISHING_MONS_SUPER_ROD_TOTAL);
 
+    // A roll past the end of a rod's table picks what the original range
+    // checks fell through to.
     switch (rod)
     {
     case OLD_ROD:
-        if (rand < ENCOUNTER_CHANCE_FISHING_MONS_OLD_ROD_SLOT_0)
-            wildMonIndex = 0;
+        if (rand < ENCOUNTER_CHANCE_FISHING_MONS_OLD_ROD_TOTAL)
+            wildMonIndex = sOldRodSlotByRoll[rand];
         else
             wildMonIndex = 1;
         break;
     case GOOD_ROD:
-        if (rand < ENCOUNTER_CHANCE_FISHING_MONS_GOOD_ROD_SLOT_2)
-            wildMonIndex = 2;
-        if (rand >= ENCOUNTER_CHANCE_FISHING_MONS_GOOD_ROD_SLOT_2 && rand < ENCOUNTER_CHANCE_FISHING_MONS_GOOD_ROD_SLOT_3)
-            wildMonIndex = 3;
-        if (rand >= ENCOUNTER_CHANCE_FISHING_MONS_GOOD_ROD_SLOT_3 && rand < ENCOUNTER_CHANCE_FISHING_MONS_GOOD_ROD_SLOT_4)
-            wildMonIndex = 4;
+        if (rand < ENCOUNTER_CHANCE_FISHING_MONS_GOOD_ROD_TOTAL)
+            wildMonIndex = sGoodRodSlotByRoll[rand];
         break;
     case SUPER_ROD:
-        if (rand < ENCOUNTER_CHANCE_FISHING_MONS_SUPER_ROD_SLOT_5)
-            wildMonIndex = 5;
-        if (rand >= ENCOUNTER_CHANCE_FISHING_MONS_SUPER_ROD_SLOT_5 && rand < ENCOUNTER_CHANCE_FISHING_MONS_SUPER_ROD_SLOT_6)
-            wildMonIndex = 6;
-        if (rand >= ENCOUNTER_CHANCE_FISHING_MONS_SUPER_ROD_SLOT_6 && rand < ENCOUNTER_CHANCE_FISHING_MONS_SUPER_ROD_SLOT_7)
-            wildMonIndex = 7;
-        if (rand >= ENCOUNTER_CHANCE_FISHING_MONS_SUPER_ROD_SLOT_7 && rand < ENCOUNTER_CHANCE_FISHING_MONS_SUPER_ROD_SLOT_8)
-            wildMonIndex = 8;
-        if (rand >= ENCOUNTER_CHANCE_FISHING_MONS_SUPER_ROD_SLOT_8 && rand < ENCOUNTER_CHANCE_FISHING_MONS_SUPER_ROD_SLOT_9)
-            wildMonIndex = 9;
+        if (rand < ENCOUNTER_CHANCE_FISHING_MONS_SUPER_ROD_TOTAL)
+            wildMonIndex = sSuperRodSlotByRoll[rand];
         break;
     }
     return wildMonIndex;
@@ -302,7 +269,7 @@ static u8 ChooseWildMonLevel(const struct WildPokemon *wildPokemon)
     return min + rand;
 }
 
-static u16 GetCurrentMapWildMonHeaderId(void)
+static u16 FindWildMonHeaderId(u8 mapGroup, u8 mapNum)
 {
     u16 i;
 
@@ -312,26 +279,40 @@ static u16 GetCurrentMapWildMonHeaderId(void)
         if (wildHeader->mapGroup == MAP_GROUP(MAP_UNDEFINED))
             break;
 
-        if (gWildMonHeaders[i].mapGroup == gSaveBlock1Ptr->location.mapGroup &&
-            gWildMonHeaders[i].mapNum == gSaveBlock1Ptr->location.mapNum)
-        {
-            if (gSaveBlock1Ptr->location.mapGroup == MAP_GROUP(MAP_ALTERING_CAVE) &&
-                gSaveBlock1Ptr->location.mapNum == MAP_NUM(MAP_ALTERING_CAVE))
-            {
-                u16 alteringCaveId = VarGet(VAR_ALTERING_CAVE_WILD_SET);
-                if (alteringCaveId >= NUM_ALTERING_CAVE_TABLES)
-                    alteringCaveId = 0;
-
-                i += alteringCaveId;
-            }
-
+        if (gWildMonHeaders[i].mapGroup == mapGroup && gWildMonHeaders[i].mapNum == mapNum)
             return i;
-        }
     }
 
     return HEADER_NONE;
 }
 
+static u16 GetCurrentMapWildMonHeaderId(void)
+{
+    u16 mapKey = MAP_HEADER_KEY(gSaveBlock1Ptr->location.mapGroup, gSaveBlock1Ptr->location.mapNum);
+    u16 headerId;
+
+    // The header table is only searched once per map, not on every step.
+    if (sCachedWildMonHeaderMapKey != mapKey)
+    {
+        sCachedWildMonHeaderId = FindWildMonHeaderId(gSaveBlock1Ptr->location.mapGroup, gSaveBlock1Ptr->location.mapNum);
+        sCachedWildMonHeaderMapKey = mapKey;
+    }
+
+    headerId = sCachedWildMonHeaderId;
+    if (headerId != HEADER_NONE
+     && gSaveBlock1Ptr->location.mapGroup == MAP_GROUP(MAP_ALTERING_CAVE)
+     && gSaveBlock1Ptr->location.mapNum == MAP_NUM(MAP_ALTERING_CAVE))
+    {
+        u16 alteringCaveId = VarGet(VAR_ALTERING_CAVE_WILD_SET);
+        if (alteringCaveId >= NUM_ALTERING_CAVE_TABLES)
+            alteringCaveId = 0;
+
+        headerId += alteringCaveId;
+    }
+
+    return headerId;
+}
+
 static u8 PickWildMonNature(void)
 {
     u8 i;
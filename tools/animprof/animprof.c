@@ -0,0 +1,490 @@
+// animprof - ranks battle move animations by the resources they use.
+//
+// Usage:
+//   animprof scripts MACROS_INC ANIM_SCRIPTS_S
+//       Walks every entry of gBattleAnims_Moves and estimates, without running
+//       the game, how many sprites, visual tasks and sprite graphics each
+//       animation can have alive at once.
+//   animprof log LOG_FILE [ANIM_SCRIPTS_S]
+//       Ranks the ANIMPROF lines printed by a build with BATTLE_ANIM_PROFILER
+//       defined. Passing the scripts file resolves move ids to labels.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <ctype.h>
+
+#define FATAL_ERROR(format, ...)            \
+do                                          \
+{                                           \
+    fprintf(stderr, format, ##__VA_ARGS__); \
+    exit(1);                                \
+} while (0)
+
+#define MAX_LINE_LENGTH 1024
+#define MAX_NAME_LENGTH 128
+#define MAX_CALL_DEPTH 16
+#define MAX_WALK_STEPS 100000
+
+enum StatementKind
+{
+    STMT_OTHER,
+    STMT_LABEL,
+    STMT_SPRITE,
+    STMT_VISUAL_TASK,
+    STMT_SOUND_TASK,
+    STMT_LOAD_GFX,
+    STMT_UNLOAD_GFX,
+    STMT_DELAY,
+    STMT_WAIT_VISUAL,
+    STMT_WAIT_SOUND,
+    STMT_CALL,
+    STMT_GOTO,
+    STMT_RETURN,
+    STMT_END,
+};
+
+struct Statement
+{
+    enum StatementKind kind;
+    char name[MAX_NAME_LENGTH]; // label name, or operand of call/goto/loadspritegfx
+    int value;                  // frames for delay
+};
+
+struct StringList
+{
+    char **items;
+    int count;
+    int capacity;
+};
+
+struct AnimStats
+{
+    int id;
+    char name[MAX_NAME_LENGTH];
+    int sprites;
+    int tasks;
+    int matrices;
+    int palettes;
+    int dmaBytes;
+    int frames;
+    int droppedFrames;
+    int samples;
+};
+
+static struct Statement *sStatements;
+static int sStatementCount;
+static int sStatementCapacity;
+
+static struct StringList sSpriteMacros;
+static struct StringList sTaskMacros;
+static struct StringList sMoveLabels;
+
+static void AddString(struct StringList *list, const char *str)
+{
+    if (list->count == list->capacity)
+    {
+        list->capacity = list->capacity ? list->capacity * 2 : 64;
+        list->items = realloc(list->items, list->capacity * sizeof(char *));
+        if (list->items == NULL)
+            FATAL_ERROR("Out of memory.\n");
+    }
+    list->items[list->count] = malloc(strlen(str) + 1);
+    if (list->items[list->count] == NULL)
+        FATAL_ERROR("Out of memory.\n");
+    strcpy(list->items[list->count++], str);
+}
+
+static bool HasString(const struct StringList *list, const char *str)
+{
+    for (int i = 0; i < list->count; i++)
+        if (strcmp(list->items[i], str) == 0)
+            return true;
+    return false;
+}
+
+static struct Statement *AddStatement(enum StatementKind kind)
+{
+    if (sStatementCount == sStatementCapacity)
+    {
+        sStatementCapacity = sStatementCapacity ? sStatementCapacity * 2 : 1024;
+        sStatements = realloc(sStatements, sStatementCapacity * sizeof(struct Statement));
+        if (sStatements == NULL)
+            FATAL_ERROR("Out of memory.\n");
+    }
+    memset(&sStatements[sStatementCount], 0, sizeof(struct Statement));
+    sStatements[sStatementCount].kind = kind;
+    return &sStatements[sStatementCount++];
+}
+
+// Copies the identifier at *p into dest and advances *p past it.
+static void ReadWord(const char **p, char *dest)
+{
+    int length = 0;
+
+    while (**p == ' ' || **p == '\t')
+        (*p)++;
+    while (**p && (isalnum((unsigned char)**p) || **p == '_' || **p == '.'))
+    {
+        if (length < MAX_NAME_LENGTH - 1)
+            dest[length++] = **p;
+        (*p)++;
+    }
+    dest[length] = 0;
+}
+
+// Copies the n-th (0-based) comma separated operand of a statement.
+static void ReadOperand(const char *p, int n, char *dest)
+{
+    while (n > 0 && *p)
+    {
+        if (*p++ == ',')
+            n--;
+    }
+    ReadWord(&p, dest);
+}
+
+static FILE *OpenFile(const char *path)
+{
+    FILE *fp = fopen(path, "r");
+
+    if (fp == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for reading.\n", path);
+    return fp;
+}
+
+static void ReadMacros(const char *path)
+{
+    char line[MAX_LINE_LENGTH];
+    char word[MAX_NAME_LENGTH];
+    char macro[MAX_NAME_LENGTH] = "";
+    FILE *fp = OpenFile(path);
+
+    while (fgets(line, sizeof(line), fp))
+    {
+        const char *p = line;
+
+        ReadWord(&p, word);
+        if (strcmp(word, ".macro") == 0)
+        {
+            ReadWord(&p, macro);
+        }
+        else if (strcmp(word, ".endm") == 0)
+        {
+            macro[0] = 0;
+        }
+        else if (macro[0] != 0)
+        {
+            if (strcmp(word, "createsprite") == 0 || HasString(&sSpriteMacros, word))
+                AddString(&sSpriteMacros, macro);
+            else if (strcmp(word, "createvisualtask") == 0 || HasString(&sTaskMacros, word))
+                AddString(&sTaskMacros, macro);
+        }
+    }
+    fclose(fp);
+}
+
+static void ReadScripts(const char *path)
+{
+    char line[MAX_LINE_LENGTH];
+    char word[MAX_NAME_LENGTH];
+    bool inMoveTable = false;
+    FILE *fp = OpenFile(path);
+
+    while (fgets(line, sizeof(line), fp))
+    {
+        const char *p = line;
+        struct Statement *stmt;
+
+        if (line[0] != ' ' && line[0] != '\t' && line[0] != '@' && strchr(line, ':'))
+        {
+            ReadWord(&p, word);
+            inMoveTable = (strcmp(word, "gBattleAnims_Moves") == 0);
+            stmt = AddStatement(STMT_LABEL);
+            strcpy(stmt->name, word);
+            continue;
+        }
+
+        ReadWord(&p, word);
+        if (word[0] == 0)
+            continue;
+
+        if (inMoveTable)
+        {
+            if (strcmp(word, ".4byte") == 0)
+            {
+                ReadWord(&p, word);
+                AddString(&sMoveLabels, word);
+            }
+            continue;
+        }
+
+        if (strcmp(word, "createsprite") == 0 || HasString(&sSpriteMacros, word))
+        {
+            AddStatement(STMT_SPRITE);
+        }
+        else if (strcmp(word, "createvisualtask") == 0 || HasString(&sTaskMacros, word))
+        {
+            AddStatement(STMT_VISUAL_TASK);
+        }
+        else if (strcmp(word, "createsoundtask") == 0)
+        {
+            AddStatement(STMT_SOUND_TASK);
+        }
+        else if (strcmp(word, "loadspritegfx") == 0 || strcmp(word, "unloadspritegfx") == 0)
+        {
+            stmt = AddStatement(word[0] == 'l' ? STMT_LOAD_GFX : STMT_UNLOAD_GFX);
+            ReadWord(&p, stmt->name);
+        }
+        else if (strcmp(word, "delay") == 0)
+        {
+            stmt = AddStatement(STMT_DELAY);
+            stmt->value = (int)strtol(p, NULL, 0);
+        }
+        else if (strcmp(word, "waitforvisualfinish") == 0)
+        {
+            AddStatement(STMT_WAIT_VISUAL);
+        }
+        else if (strcmp(word, "waitsound") == 0)
+        {
+            AddStatement(STMT_WAIT_SOUND);
+        }
+        else if (strcmp(word, "call") == 0 || strcmp(word, "goto") == 0)
+        {
+            stmt = AddStatement(word[0] == 'c' ? STMT_CALL : STMT_GOTO);
+            ReadOperand(p, 0, stmt->name);
+        }
+        else if (strcmp(word, "return") == 0)
+        {
+            AddStatement(STMT_RETURN);
+        }
+        else if (strcmp(word, "end") == 0)
+        {
+            AddStatement(STMT_END);
+        }
+    }
+    fclose(fp);
+}
+
+static int FindLabel(const char *name)
+{
+    for (int i = 0; i < sStatementCount; i++)
+        if (sStatements[i].kind == STMT_LABEL && strcmp(sStatements[i].name, name) == 0)
+            return i;
+    return -1;
+}
+
+// Follows the script the way the engine does when every conditional jump
+// falls through. Everything spawned between two waitforvisualfinish commands
+// is assumed to be alive at the same time.
+static void WalkAnimScript(struct AnimStats *stats, int start)
+{
+    int callStack[MAX_CALL_DEPTH];
+    int callDepth = 0;
+    int liveSprites = 0, liveTasks = 0, liveGfx = 0;
+    int pc = start;
+    int steps;
+
+    for (steps = 0; pc >= 0 && pc < sStatementCount && steps < MAX_WALK_STEPS; steps++)
+    {
+        const struct Statement *stmt = &sStatements[pc++];
+
+        switch (stmt->kind)
+        {
+        case STMT_SPRITE:
+            liveSprites++;
+            break;
+        case STMT_VISUAL_TASK:
+        case STMT_SOUND_TASK:
+            liveTasks++;
+            break;
+        case STMT_LOAD_GFX:
+            liveGfx++;
+            break;
+        case STMT_UNLOAD_GFX:
+            if (liveGfx > 0)
+                liveGfx--;
+            break;
+        case STMT_DELAY:
+            stats->frames += stmt->value ? stmt->value : 1;
+            break;
+        case STMT_WAIT_VISUAL:
+            liveSprites = 0;
+            liveTasks = 0;
+            stats->frames++;
+            break;
+        case STMT_WAIT_SOUND:
+            stats->frames++;
+            break;
+        case STMT_CALL:
+            if (callDepth == MAX_CALL_DEPTH)
+                FATAL_ERROR("Call stack overflow in %s.\n", stats->name);
+            callStack[callDepth++] = pc;
+            pc = FindLabel(stmt->name);
+            break;
+        case STMT_GOTO:
+            pc = FindLabel(stmt->name);
+            break;
+        case STMT_RETURN:
+            pc = callDepth > 0 ? callStack[--callDepth] : -1;
+            break;
+        case STMT_END:
+            pc = -1;
+            break;
+        case STMT_LABEL:
+        case STMT_OTHER:
+            break;
+        }
+
+        if (liveSprites > stats->sprites)
+            stats->sprites = liveSprites;
+        if (liveTasks > stats->tasks)
+            stats->tasks = liveTasks;
+        if (liveGfx > stats->palettes)
+            stats->palettes = liveGfx;
+    }
+}
+
+static int CompareStats(const void *a, const void *b)
+{
+    const struct AnimStats *x = a;
+    const struct AnimStats *y = b;
+
+    if (x->sprites != y->sprites)
+        return y->sprites - x->sprites;
+    if (x->droppedFrames != y->droppedFrames)
+        return y->droppedFrames - x->droppedFrames;
+    if (x->tasks != y->tasks)
+        return y->tasks - x->tasks;
+    if (x->palettes != y->palettes)
+        return y->palettes - x->palettes;
+    return x->id - y->id;
+}
+
+static void ProfileScripts(const char *macrosPath, const char *scriptsPath)
+{
+    struct AnimStats *stats;
+
+    ReadMacros(macrosPath);
+    ReadScripts(scriptsPath);
+
+    stats = calloc(sMoveLabels.count, sizeof(struct AnimStats));
+    if (stats == NULL)
+        FATAL_ERROR("Out of memory.\n");
+
+    for (int i = 0; i < sMoveLabels.count; i++)
+    {
+        int start = FindLabel(sMoveLabels.items[i]);
+
+        stats[i].id = i;
+        snprintf(stats[i].name, MAX_NAME_LENGTH, "%s", sMoveLabels.items[i]);
+        if (start < 0)
+            FATAL_ERROR("Animation label %s not found.\n", sMoveLabels.items[i]);
+        WalkAnimScript(&stats[i], start);
+    }
+
+    qsort(stats, sMoveLabels.count, sizeof(struct AnimStats), CompareStats);
+
+    printf("%-5s %-32s %7s %5s %9s %6s\n", "id", "animation", "sprites", "tasks", "spritegfx", "frames");
+    for (int i = 0; i < sMoveLabels.count; i++)
+        printf("%-5d %-32s %7d %5d %9d %6d\n", stats[i].id, stats[i].name,
+               stats[i].sprites, stats[i].tasks, stats[i].palettes, stats[i].frames);
+
+    free(stats);
+}
+
+static int ReadField(const char *line, const char *key)
+{
+    const char *p = strstr(line, key);
+
+    if (p == NULL)
+        return 0;
+    return (int)strtol(p + strlen(key), NULL, 10);
+}
+
+static void Maximize(int *dest, int value)
+{
+    if (value > *dest)
+        *dest = value;
+}
+
+static void ProfileLog(const char *logPath, const char *scriptsPath)
+{
+    char line[MAX_LINE_LENGTH];
+    struct AnimStats *stats = NULL;
+    int count = 0, capacity = 0;
+    FILE *fp;
+
+    if (scriptsPath != NULL)
+        ReadScripts(scriptsPath);
+
+    fp = OpenFile(logPath);
+    while (fgets(line, sizeof(line), fp))
+    {
+        const char *p = strstr(line, "ANIMPROF move=");
+        struct AnimStats *entry = NULL;
+        int id;
+
+        // Only move animations have stable ids worth ranking.
+        if (p == NULL)
+            continue;
+        id = ReadField(p, "move=");
+
+        for (int i = 0; i < count; i++)
+            if (stats[i].id == id)
+                entry = &stats[i];
+
+        if (entry == NULL)
+        {
+            if (count == capacity)
+            {
+                capacity = capacity ? capacity * 2 : 64;
+                stats = realloc(stats, capacity * sizeof(struct AnimStats));
+                if (stats == NULL)
+                    FATAL_ERROR("Out of memory.\n");
+            }
+            entry = &stats[count++];
+            memset(entry, 0, sizeof(*entry));
+            entry->id = id;
+            if (id < sMoveLabels.count)
+                snprintf(entry->name, MAX_NAME_LENGTH, "%s", sMoveLabels.items[id]);
+            else
+                snprintf(entry->name, MAX_NAME_LENGTH, "move %d", id);
+        }
+
+        Maximize(&entry->sprites, ReadField(p, "sprites="));
+        Maximize(&entry->tasks, ReadField(p, "tasks="));
+        Maximize(&entry->matrices, ReadField(p, "matrices="));
+        Maximize(&entry->palettes, ReadField(p, "palettes="));
+        Maximize(&entry->dmaBytes, ReadField(p, "dma="));
+        Maximize(&entry->frames, ReadField(p, "frames="));
+        Maximize(&entry->droppedFrames, ReadField(p, "dropped="));
+        entry->samples++;
+    }
+    fclose(fp);
+
+    qsort(stats, count, sizeof(struct AnimStats), CompareStats);
+
+    printf("%-5s %-32s %7s %5s %8s %8s %8s %6s %7s %4s\n", "id", "animation",
+           "sprites", "tasks", "matrices", "palettes", "dma", "frames", "dropped", "runs");
+    for (int i = 0; i < count; i++)
+        printf("%-5d %-32s %7d %5d %8d %8d %8d %6d %7d %4d\n", stats[i].id, stats[i].name,
+               stats[i].sprites, stats[i].tasks, stats[i].matrices, stats[i].palettes,
+               stats[i].dmaBytes, stats[i].frames, stats[i].droppedFrames, stats[i].samples);
+
+    free(stats);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc == 4 && strcmp(argv[1], "scripts") == 0)
+        ProfileScripts(argv[2], argv[3]);
+    else if ((argc == 3 || argc == 4) && strcmp(argv[1], "log") == 0)
+        ProfileLog(argv[2], argc == 4 ? argv[3] : NULL);
+    else
+        FATAL_ERROR("Usage: animprof scripts MACROS_INC ANIM_SCRIPTS_S\n"
+                    "       animprof log LOG_FILE [ANIM_SCRIPTS_S]\n");
+
+    return 0;
+}
@@ -0,0 +1,371 @@
+// bagtest - checks the bag code in src/item.c against the original versions
+// of the functions it replaced (item_orig.c) over randomised pockets, and
+// times both on the host.
+//
+// Usage:
+//   bagtest
+//       Exits with 1 after printing the first mismatch, if any.
+//
+// Checked, starting from the same random bag and encryption key each time:
+//   - CheckBagHasSpace and AddBagItem return the same result as the
+//     originals and leave every slot of every pocket the same. The items
+//     added are mostly ones already in the pocket, with counts around the
+//     slot capacity, so stacks fill up and spill into new slots.
+//   - CompactItemsInBagPocket gives the same slots in the same order, for
+//     every pocket, including emptied slots that still hold an item id.
+//   - SortBerriesOrTMHMs gives the same slots in the same order, for the
+//     TM/HM and Berries pockets it is used on. Those never hold two stacks
+//     of one item, so neither do the pockets made for it here.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "global.h"
+#include "item.h"
+#include "malloc.h"
+#include "constants/battle_pyramid.h"
+#include "constants/items.h"
+#include "item_orig.h"
+
+#define FATAL_ERROR(format, ...)            \
+do                                          \
+{                                           \
+    fprintf(stderr, format, ##__VA_ARGS__); \
+    exit(1);                                \
+} while (0)
+
+#define NUM_TEST_BAGS 200000
+#define NUM_BENCH_POCKETS 1000
+#define BENCH_ROUNDS 200
+
+static struct SaveBlock1 sSaveBlock1;
+static struct SaveBlock2 sSaveBlock2;
+
+struct SaveBlock1 *gSaveBlock1Ptr = &sSaveBlock1;
+struct SaveBlock2 *gSaveBlock2Ptr = &sSaveBlock2;
+
+// The game functions item.c calls on the way to the regular bag.
+bool8 FlagGet(u16 id)
+{
+    (void)id;
+    return FALSE;
+}
+
+u8 CurrentBattlePyramidLocation(void)
+{
+    return PYRAMID_LOCATION_NONE;
+}
+
+void *AllocZeroed(u32 size)
+{
+    return calloc(1, size);
+}
+
+void Free(void *pointer)
+{
+    free(pointer);
+}
+
+static u16 sPocketItems[POCKETS_COUNT][ITEMS_COUNT];
+static u16 sNumPocketItems[POCKETS_COUNT];
+
+static u32 sRngState = 0x12345678;
+
+static u32 NextRandom(void)
+{
+    sRngState ^= sRngState << 13;
+    sRngState ^= sRngState >> 17;
+    sRngState ^= sRngState << 5;
+    return sRngState;
+}
+
+static u16 GetSlotCapacity(u8 pocket)
+{
+    return pocket == BERRIES_POCKET ? MAX_BERRY_CAPACITY : MAX_BAG_ITEM_CAPACITY;
+}
+
+static bool32 CanHoldDuplicates(u8 pocket)
+{
+    return pocket != TMHM_POCKET && pocket != BERRIES_POCKET;
+}
+
+static void InitPocketItems(void)
+{
+    u16 itemId;
+
+    for (itemId = ITEM_NONE + 1; itemId < ITEMS_COUNT; itemId++)
+    {
+        u8 pocket = GetItemPocket(itemId);
+
+        if (pocket != POCKET_NONE)
+        {
+            pocket--;
+            sPocketItems[pocket][sNumPocketItems[pocket]++] = itemId;
+        }
+    }
+}
+
+static bool32 PocketHasItem(const struct BagPocket *bagPocket, u16 itemId)
+{
+    int i;
+
+    for (i = 0; i < bagPocket->capacity; i++)
+    {
+        if (bagPocket->itemSlots[i].itemId == itemId)
+            return TRUE;
+    }
+    return FALSE;
+}
+
+static u16 RandomQuantity(u8 pocket)
+{
+    u16 capacity = GetSlotCapacity(pocket);
+
+    switch (NextRandom() % 4)
+    {
+    case 0:
+        return capacity;
+    case 1:
+        return capacity - NextRandom() % 3;
+    default:
+        return 1 + NextRandom() % capacity;
+    }
+}
+
+// Fills a pocket to a random degree. With strayIds, some empty slots keep
+// an item id, which only the compaction and sorting tests can cope with.
+static void FillRandomPocket(u8 pocket, bool32 strayIds)
+{
+    struct BagPocket *bagPocket = &gBagPockets[pocket];
+    u32 fillChance = NextRandom() % 5 == 0 ? 100 : NextRandom() % 101;
+    int i;
+
+    for (i = 0; i < bagPocket->capacity; i++)
+    {
+        struct ItemSlot *slot = &bagPocket->itemSlots[i];
+
+        slot->itemId = ITEM_NONE;
+        slot->quantity = 0 ^ gSaveBlock2Ptr->encryptionKey;
+        if (NextRandom() % 100 < fillChance)
+        {
+            u16 itemId = sPocketItems[pocket][NextRandom() % sNumPocketItems[pocket]];
+
+            if (!CanHoldDuplicates(pocket) && PocketHasItem(bagPocket, itemId))
+                continue;
+            slot->itemId = itemId;
+            slot->quantity = RandomQuantity(pocket) ^ gSaveBlock2Ptr->encryptionKey;
+        }
+        else if (strayIds && NextRandom() % 8 == 0)
+        {
+            slot->itemId = sPocketItems[pocket][NextRandom() % sNumPocketItems[pocket]];
+        }
+    }
+}
+
+static void FillRandomBag(bool32 strayIds)
+{
+    u8 pocket;
+
+    gSaveBlock2Ptr->encryptionKey = NextRandom();
+    for (pocket = 0; pocket < POCKETS_COUNT; pocket++)
+        FillRandomPocket(pocket, strayIds);
+}
+
+static u16 RandomItemToAdd(u8 *pocketOut)
+{
+    u8 pocket = NextRandom() % POCKETS_COUNT;
+    struct BagPocket *bagPocket = &gBagPockets[pocket];
+    u16 itemId = ITEM_NONE;
+
+    // Mostly add more of something the pocket already has.
+    if (NextRandom() % 4 != 0)
+        itemId = bagPocket->itemSlots[NextRandom() % bagPocket->capacity].itemId;
+    if (itemId == ITEM_NONE)
+        itemId = sPocketItems[pocket][NextRandom() % sNumPocketItems[pocket]];
+    *pocketOut = pocket;
+    return itemId;
+}
+
+static u16 RandomCountToAdd(u8 pocket)
+{
+    u16 capacity = GetSlotCapacity(pocket);
+
+    switch (NextRandom() % 6)
+    {
+    case 0:
+        return 1;
+    case 1:
+        return 1 + NextRandom() % 10;
+    case 2:
+        return capacity - 2 + NextRandom() % 5;
+    case 3:
+        return capacity * (1 + NextRandom() % 4) - 2 + NextRandom() % 5;
+    case 4:
+        return NextRandom() % 0x10000;
+    default:
+        return 1 + NextRandom() % capacity;
+    }
+}
+
+static void ComparePockets(const struct ItemSlot *expected, const struct ItemSlot *actual, u8 capacity, const char *test, unsigned bag)
+{
+    int i;
+
+    for (i = 0; i < capacity; i++)
+    {
+        if (expected[i].itemId != actual[i].itemId || expected[i].quantity != actual[i].quantity)
+        {
+            FATAL_ERROR("%s, bag %u: slot %d is item %u quantity %u, expected item %u quantity %u\n",
+                        test, bag, i,
+                        actual[i].itemId, (u16)(actual[i].quantity ^ gSaveBlock2Ptr->encryptionKey),
+                        expected[i].itemId, (u16)(expected[i].quantity ^ gSaveBlock2Ptr->encryptionKey));
+        }
+    }
+}
+
+static void CheckAddBagItem(unsigned bag)
+{
+    struct SaveBlock1 before, expected;
+    bool8 hasSpace, added;
+    u8 pocket;
+    u16 itemId, count;
+
+    FillRandomBag(FALSE);
+    itemId = RandomItemToAdd(&pocket);
+    count = RandomCountToAdd(pocket);
+
+    before = sSaveBlock1;
+    hasSpace = OrigCheckBagHasSpace(itemId, count);
+    added = OrigAddBagItem(itemId, count);
+    expected = sSaveBlock1;
+
+    sSaveBlock1 = before;
+    if (CheckBagHasSpace(itemId, count) != hasSpace)
+        FATAL_ERROR("CheckBagHasSpace, bag %u: %u of item %u gives %d, expected %d\n", bag, count, itemId, !hasSpace, hasSpace);
+    if (AddBagItem(itemId, count) != added)
+        FATAL_ERROR("AddBagItem, bag %u: %u of item %u gives %d, expected %d\n", bag, count, itemId, !added, added);
+    for (pocket = 0; pocket < POCKETS_COUNT; pocket++)
+    {
+        ptrdiff_t offset = (u8 *)gBagPockets[pocket].itemSlots - (u8 *)&sSaveBlock1;
+
+        ComparePockets((const struct ItemSlot *)((u8 *)&expected + offset), gBagPockets[pocket].itemSlots,
+                       gBagPockets[pocket].capacity, "AddBagItem", bag);
+    }
+}
+
+static void CheckReorder(unsigned bag, u8 pocket, void (*newFunc)(struct BagPocket *), void (*origFunc)(struct BagPocket *), const char *test)
+{
+    struct BagPocket *bagPocket = &gBagPockets[pocket];
+    struct ItemSlot before[BAG_TMHM_COUNT], expected[BAG_TMHM_COUNT];
+    size_t size = bagPocket->capacity * sizeof(struct ItemSlot);
+
+    memcpy(before, bagPocket->itemSlots, size);
+    origFunc(bagPocket);
+    memcpy(expected, bagPocket->itemSlots, size);
+    memcpy(bagPocket->itemSlots, before, size);
+    newFunc(bagPocket);
+    ComparePockets(expected, bagPocket->itemSlots, bagPocket->capacity, test, bag);
+}
+
+static void CheckCompactAndSort(unsigned bag)
+{
+    u8 pocket;
+
+    FillRandomBag(TRUE);
+    for (pocket = 0; pocket < POCKETS_COUNT; pocket++)
+        CheckReorder(bag, pocket, CompactItemsInBagPocket, OrigCompactItemsInBagPocket, "CompactItemsInBagPocket");
+    CheckReorder(bag, TMHM_POCKET, SortBerriesOrTMHMs, OrigSortBerriesOrTMHMs, "SortBerriesOrTMHMs (TM/HM)");
+    CheckReorder(bag, BERRIES_POCKET, SortBerriesOrTMHMs, OrigSortBerriesOrTMHMs, "SortBerriesOrTMHMs (Berries)");
+}
+
+static double Seconds(clock_t start)
+{
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+static double TimeSort(void (*func)(struct BagPocket *), struct ItemSlot (*pockets)[BAG_TMHM_COUNT])
+{
+    struct BagPocket *bagPocket = &gBagPockets[TMHM_POCKET];
+    clock_t start = clock();
+    int round, i;
+
+    for (round = 0; round < BENCH_ROUNDS; round++)
+    {
+        for (i = 0; i < NUM_BENCH_POCKETS; i++)
+        {
+            memcpy(bagPocket->itemSlots, pockets[i], sizeof(pockets[i]));
+            func(bagPocket);
+        }
+    }
+    return Seconds(start) * 1e9 / (BENCH_ROUNDS * NUM_BENCH_POCKETS);
+}
+
+static double TimeAdd(bool8 (*func)(u16, u16), const struct SaveBlock1 *bags, const u16 *itemIds, const u16 *counts)
+{
+    clock_t start = clock();
+    int round, i;
+
+    for (round = 0; round < BENCH_ROUNDS; round++)
+    {
+        for (i = 0; i < NUM_BENCH_POCKETS; i++)
+        {
+            memcpy(sSaveBlock1.bagPocket_Items, bags[i].bagPocket_Items,
+                   (u8 *)&sSaveBlock1.pokeblocks - (u8 *)&sSaveBlock1.bagPocket_Items);
+            func(itemIds[i], counts[i]);
+        }
+    }
+    return Seconds(start) * 1e9 / (BENCH_ROUNDS * NUM_BENCH_POCKETS);
+}
+
+static void Benchmark(void)
+{
+    static struct ItemSlot sTMHMPockets[NUM_BENCH_POCKETS][BAG_TMHM_COUNT];
+    static struct SaveBlock1 sBags[NUM_BENCH_POCKETS];
+    static u16 sItemIds[NUM_BENCH_POCKETS], sCounts[NUM_BENCH_POCKETS];
+    double origSort, sort, origAdd, add;
+    int i;
+
+    gSaveBlock2Ptr->encryptionKey = NextRandom();
+    for (i = 0; i < NUM_BENCH_POCKETS; i++)
+    {
+        u8 pocket;
+
+        FillRandomPocket(TMHM_POCKET, FALSE);
+        memcpy(sTMHMPockets[i], gBagPockets[TMHM_POCKET].itemSlots, sizeof(sTMHMPockets[i]));
+
+        for (pocket = 0; pocket < POCKETS_COUNT; pocket++)
+            FillRandomPocket(pocket, FALSE);
+        sBags[i] = sSaveBlock1;
+        sItemIds[i] = RandomItemToAdd(&pocket);
+        sCounts[i] = 1 + NextRandom() % 10;
+    }
+
+    origSort = TimeSort(OrigSortBerriesOrTMHMs, sTMHMPockets);
+    sort = TimeSort(SortBerriesOrTMHMs, sTMHMPockets);
+    origAdd = TimeAdd(OrigAddBagItem, sBags, sItemIds, sCounts);
+    add = TimeAdd(AddBagItem, sBags, sItemIds, sCounts);
+
+    printf("benchmark, %d calls each:\n", BENCH_ROUNDS * NUM_BENCH_POCKETS);
+    printf("  SortBerriesOrTMHMs (TM/HM pocket): original %7.1f ns/call, now %7.1f ns/call\n", origSort, sort);
+    printf("  AddBagItem:                        original %7.1f ns/call, now %7.1f ns/call\n", origAdd, add);
+}
+
+int main(void)
+{
+    unsigned bag;
+
+    SetBagItemsPointers();
+    InitPocketItems();
+
+    for (bag = 0; bag < NUM_TEST_BAGS; bag++)
+    {
+        CheckAddBagItem(bag);
+        CheckCompactAndSort(bag);
+    }
+    printf("CheckBagHasSpace, AddBagItem, CompactItemsInBagPocket and SortBerriesOrTMHMs\n");
+    printf("match the originals on %d random bags\n", NUM_TEST_BAGS);
+
+    Benchmark();
+    return 0;
+}
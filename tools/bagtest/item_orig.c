@@ -0,0 +1,223 @@
+// CheckBagHasSpace, AddBagItem, CompactItemsInBagPocket and
+// SortBerriesOrTMHMs as they were in src/item.c before they were rewritten,
+// renamed with an Orig prefix. They are kept as the reference bagtest checks
+// the current code against, so don't change them to match src/item.c.
+//
+// The Battle Pyramid bag branches are left out, since bagtest only fills the
+// regular bag.
+
+#include "global.h"
+#include "item.h"
+#include "malloc.h"
+#include "constants/items.h"
+#include "item_orig.h"
+
+static u16 GetBagItemQuantity(u16 *quantity)
+{
+    return gSaveBlock2Ptr->encryptionKey ^ *quantity;
+}
+
+static void SetBagItemQuantity(u16 *quantity, u16 newValue)
+{
+    *quantity =  newValue ^ gSaveBlock2Ptr->encryptionKey;
+}
+
+bool8 OrigCheckBagHasSpace(u16 itemId, u16 count)
+{
+    u8 i;
+    u8 pocket;
+    u16 slotCapacity;
+    u16 ownedCount;
+
+    if (GetItemPocket(itemId) == POCKET_NONE)
+        return FALSE;
+
+    pocket = GetItemPocket(itemId) - 1;
+    if (pocket != BERRIES_POCKET)
+        slotCapacity = MAX_BAG_ITEM_CAPACITY;
+    else
+        slotCapacity = MAX_BERRY_CAPACITY;
+
+    // Check space in any existing item slots that already contain this item
+    for (i = 0; i < gBagPockets[pocket].capacity; i++)
+    {
+        if (gBagPockets[pocket].itemSlots[i].itemId == itemId)
+        {
+            ownedCount = GetBagItemQuantity(&gBagPockets[pocket].itemSlots[i].quantity);
+            if (ownedCount + count <= slotCapacity)
+                return TRUE;
+            if (pocket == TMHM_POCKET || pocket == BERRIES_POCKET)
+                return FALSE;
+            count -= (slotCapacity - ownedCount);
+            if (count == 0)
+                break; //should be return TRUE, but that doesn't match
+        }
+    }
+
+    // Check space in empty item slots
+    if (count > 0)
+    {
+        for (i = 0; i < gBagPockets[pocket].capacity; i++)
+        {
+            if (gBagPockets[pocket].itemSlots[i].itemId == 0)
+            {
+                if (count > slotCapacity)
+                {
+                    if (pocket == TMHM_POCKET || pocket == BERRIES_POCKET)
+                        return FALSE;
+                    count -= slotCapacity;
+                }
+                else
+                {
+                    count = 0; //should be return TRUE, but that doesn't match
+                    break;
+                }
+            }
+        }
+        if (count > 0)
+            return FALSE; // No more item slots. The bag is full
+    }
+
+    return TRUE;
+}
+
+bool8 OrigAddBagItem(u16 itemId, u16 count)
+{
+    u8 i;
+
+    if (GetItemPocket(itemId) == POCKET_NONE)
+        return FALSE;
+
+    {
+        struct BagPocket *itemPocket;
+        struct ItemSlot *newItems;
+        u16 slotCapacity;
+        u16 ownedCount;
+        u8 pocket = GetItemPocket(itemId) - 1;
+
+        itemPocket = &gBagPockets[pocket];
+        newItems = AllocZeroed(itemPocket->capacity * sizeof(struct ItemSlot));
+        memcpy(newItems, itemPocket->itemSlots, itemPocket->capacity * sizeof(struct ItemSlot));
+
+        if (pocket != BERRIES_POCKET)
+            slotCapacity = MAX_BAG_ITEM_CAPACITY;
+        else
+            slotCapacity = MAX_BERRY_CAPACITY;
+
+        for (i = 0; i < itemPocket->capacity; i++)
+        {
+            if (newItems[i].itemId == itemId)
+            {
+                ownedCount = GetBagItemQuantity(&newItems[i].quantity);
+                // check if won't exceed max slot capacity
+                if (ownedCount + count <= slotCapacity)
+                {
+                    // successfully added to already existing item's count
+                    SetBagItemQuantity(&newItems[i].quantity, ownedCount + count);
+                    memcpy(itemPocket->itemSlots, newItems, itemPocket->capacity * sizeof(struct ItemSlot));
+                    Free(newItems);
+                    return TRUE;
+                }
+                else
+                {
+                    // try creating another instance of the item if possible
+                    if (pocket == TMHM_POCKET || pocket == BERRIES_POCKET)
+                    {
+                        Free(newItems);
+                        return FALSE;
+                    }
+                    else
+                    {
+                        count -= slotCapacity - ownedCount;
+                        SetBagItemQuantity(&newItems[i].quantity, slotCapacity);
+                        // don't create another instance of the item if it's at max slot capacity and count is equal to 0
+                        if (count == 0)
+                        {
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+
+        // we're done if quantity is equal to 0
+        if (count > 0)
+        {
+            // either no existing item was found or we have to create another instance, because the capacity was exceeded
+            for (i = 0; i < itemPocket->capacity; i++)
+            {
+                if (newItems[i].itemId == ITEM_NONE)
+                {
+                    newItems[i].itemId = itemId;
+                    if (count > slotCapacity)
+                    {
+                        // try creating a new slot with max capacity if duplicates are possible
+                        if (pocket == TMHM_POCKET || pocket == BERRIES_POCKET)
+                        {
+                            Free(newItems);
+                            return FALSE;
+                        }
+                        count -= slotCapacity;
+                        SetBagItemQuantity(&newItems[i].quantity, slotCapacity);
+                    }
+                    else
+                    {
+                        // created a new slot and added quantity
+                        SetBagItemQuantity(&newItems[i].quantity, count);
+                        count = 0;
+                        break;
+                    }
+                }
+            }
+
+            if (count > 0)
+            {
+                Free(newItems);
+                return FALSE;
+            }
+        }
+        memcpy(itemPocket->itemSlots, newItems, itemPocket->capacity * sizeof(struct ItemSlot));
+        Free(newItems);
+        return TRUE;
+    }
+}
+
+static void SwapItemSlots(struct ItemSlot *a, struct ItemSlot *b)
+{
+    struct ItemSlot temp;
+    SWAP(*a, *b, temp);
+}
+
+void OrigCompactItemsInBagPocket(struct BagPocket *bagPocket)
+{
+    u16 i, j;
+
+    for (i = 0; i < bagPocket->capacity - 1; i++)
+    {
+        for (j = i + 1; j < bagPocket->capacity; j++)
+        {
+            if (GetBagItemQuantity(&bagPocket->itemSlots[i].quantity) == 0)
+                SwapItemSlots(&bagPocket->itemSlots[i], &bagPocket->itemSlots[j]);
+        }
+    }
+}
+
+void OrigSortBerriesOrTMHMs(struct BagPocket *bagPocket)
+{
+    u16 i, j;
+
+    for (i = 0; i < bagPocket->capacity - 1; i++)
+    {
+        for (j = i + 1; j < bagPocket->capacity; j++)
+        {
+            if (GetBagItemQuantity(&bagPocket->itemSlots[i].quantity) != 0)
+            {
+                if (GetBagItemQuantity(&bagPocket->itemSlots[j].quantity) == 0)
+                    continue;
+                if (bagPocket->itemSlots[i].itemId <= bagPocket->itemSlots[j].itemId)
+                    continue;
+            }
+            SwapItemSlots(&bagPocket->itemSlots[i], &bagPocket->itemSlots[j]);
+        }
+    }
+}
@@ -0,0 +1,9 @@
+#ifndef GUARD_ITEM_ORIG_H
+#define GUARD_ITEM_ORIG_H
+
+bool8 OrigCheckBagHasSpace(u16 itemId, u16 count);
+bool8 OrigAddBagItem(u16 itemId, u16 count);
+void OrigCompactItemsInBagPocket(struct BagPocket *bagPocket);
+void OrigSortBerriesOrTMHMs(struct BagPocket *bagPocket);
+
+#endif // GUARD_ITEM_ORIG_H
@@ -0,0 +1,14 @@
+// Entry points for eggtest to the static functions in src/daycare.c. Like
+// daycare_orig.c, this is appended to that file by the Makefile.
+
+#include "daycare_exports.h"
+
+u16 NewGetEggSpecies(u16 species)
+{
+    return GetEggSpecies(species);
+}
+
+u8 NewGetEggMoves(struct Pokemon *pokemon, u16 *eggMoves)
+{
+    return GetEggMoves(pokemon, eggMoves);
+}
@@ -0,0 +1,7 @@
+#ifndef GUARD_DAYCARE_EXPORTS_H
+#define GUARD_DAYCARE_EXPORTS_H
+
+u16 NewGetEggSpecies(u16 species);
+u8 NewGetEggMoves(struct Pokemon *pokemon, u16 *eggMoves);
+
+#endif // GUARD_DAYCARE_EXPORTS_H
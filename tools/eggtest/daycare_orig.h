@@ -0,0 +1,7 @@
+#ifndef GUARD_DAYCARE_ORIG_H
+#define GUARD_DAYCARE_ORIG_H
+
+u16 OrigGetEggSpecies(u16 species);
+u8 OrigGetEggMoves(struct Pokemon *pokemon, u16 *eggMoves);
+
+#endif // GUARD_DAYCARE_ORIG_H
@@ -0,0 +1,284 @@
+// learnsettest - checks the level up learnset code in src/pokemon.c against
+// the linear scans it replaced (pokemon_orig.c), and that the learnsets are
+// in the order the binary search needs.
+//
+// Usage:
+//   learnsettest
+//       Exits with 1 after printing the first problem, if any.
+//
+// Checked:
+//   - Every species' level up learnset is sorted by level. CountLevelUpMovesUpToLevel
+//     binary searches it, so a move added out of order would be skipped.
+//   - CountLevelUpMovesUpToLevel gives the same count as the Apprentice's
+//     scan, for every species and every level up to past MAX_LEVEL.
+//   - For every species at every level, starting from the same mon:
+//       - GiveBoxMonInitialMoveset leaves the mon the same as the original.
+//       - MonTryLearningNewMove returns the same moves, call after call, and
+//         leaves the mon the same.
+//       - GetMoveRelearnerMoves and GetNumberOfRelearnableMoves give the same
+//         moves, with known moves drawn from the learnset and at random.
+//   - GetNextSpeciesTMHM visits exactly the TMs/HMs CanSpeciesLearnTMHM
+//     allows, and CountSpeciesTMHMs counts them, for every species.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "global.h"
+#include "battle.h"
+#include "data.h"
+#include "main.h"
+#include "pokemon.h"
+#include "random.h"
+#include "constants/items.h"
+#include "constants/moves.h"
+#include "constants/region_map_sections.h"
+#include "constants/species.h"
+#include "pokemon_orig.h"
+
+#define FATAL_ERROR(format, ...)            \
+do                                          \
+{                                           \
+    fprintf(stderr, format, ##__VA_ARGS__); \
+    exit(1);                                \
+} while (0)
+
+#define NUM_RELEARNER_TRIALS 8
+
+static struct SaveBlock2 sSaveBlock2;
+
+struct SaveBlock2 *gSaveBlock2Ptr = &sSaveBlock2;
+
+// The game data CreateMon and MonTryLearningNewMove use from outside
+// pokemon.c. The names and versions don't matter here, they're just the same
+// for both sides.
+const u8 gSpeciesNames[NUM_SPECIES][POKEMON_NAME_LENGTH + 1];
+const u8 gGameVersion = VERSION_EMERALD;
+const u8 gGameLanguage = LANGUAGE_ENGLISH;
+u16 gMoveToLearn;
+struct BattleScripting gBattleScripting;
+
+// The game gets this from m4a_1.s. CalculateMonStats divides with it.
+u32 umul3232H32(u32 multiplier, u32 multiplicand)
+{
+    return ((u64)multiplier * multiplicand) >> 32;
+}
+
+static u32 sRngState = 0x12345678;
+
+static u32 NextRandom(void)
+{
+    sRngState ^= sRngState << 13;
+    sRngState ^= sRngState >> 17;
+    sRngState ^= sRngState << 5;
+    return sRngState;
+}
+
+// The game functions CreateMon calls.
+u16 Random(void)
+{
+    return NextRandom();
+}
+
+u8 GetCurrentRegionMapSectionId(void)
+{
+    return MAPSEC_LITTLEROOT_TOWN;
+}
+
+static void CheckSorted(void)
+{
+    u32 species;
+
+    for (species = 0; species < NUM_SPECIES; species++)
+    {
+        const u16 *learnset = gLevelUpLearnsets[species];
+        u32 i;
+
+        for (i = 1; learnset[0] != LEVEL_UP_END && learnset[i] != LEVEL_UP_END; i++)
+        {
+            if ((learnset[i] & LEVEL_UP_MOVE_LV) < (learnset[i - 1] & LEVEL_UP_MOVE_LV))
+                FATAL_ERROR("Species %u: learnset entry %u is at level %u, after one at level %u. Learnsets must be sorted by level.\n",
+                            species, i, learnset[i] >> 9, learnset[i - 1] >> 9);
+        }
+    }
+}
+
+static void CheckCounts(void)
+{
+    u32 species, level;
+
+    for (species = 0; species < NUM_SPECIES; species++)
+    {
+        for (level = 0; level <= MAX_LEVEL + 1; level++)
+        {
+            u8 count = CountLevelUpMovesUpToLevel(species, level);
+            u8 expected = OrigCountLevelUpMovesUpToLevel(species, level);
+
+            if (count != expected)
+                FATAL_ERROR("CountLevelUpMovesUpToLevel, species %u level %u: %u moves, expected %u\n",
+                            species, level, count, expected);
+        }
+    }
+}
+
+static void ClearMoves(struct Pokemon *mon)
+{
+    u32 i;
+    u16 move = MOVE_NONE;
+    u8 pp = 0;
+
+    for (i = 0; i < MAX_MON_MOVES; i++)
+    {
+        SetMonData(mon, MON_DATA_MOVE1 + i, &move);
+        SetMonData(mon, MON_DATA_PP1 + i, &pp);
+    }
+}
+
+static void CheckSameMon(const struct Pokemon *mon, const struct Pokemon *expected, const char *what, u32 species, u32 level)
+{
+    if (memcmp(mon, expected, sizeof(*mon)) != 0)
+        FATAL_ERROR("%s, species %u level %u: the mon differs from the original's\n", what, species, level);
+}
+
+static void CheckInitialMoveset(const struct Pokemon *created, u32 species, u32 level)
+{
+    struct Pokemon mon = *created;
+    struct Pokemon expected = *created;
+
+    ClearMoves(&mon);
+    ClearMoves(&expected);
+    GiveBoxMonInitialMoveset(&mon.box);
+    OrigGiveBoxMonInitialMoveset(&expected.box);
+    CheckSameMon(&mon, &expected, "GiveBoxMonInitialMoveset", species, level);
+}
+
+static void CheckLearningNewMoves(const struct Pokemon *created, u32 species, u32 level)
+{
+    struct Pokemon mon = *created;
+    struct Pokemon expected = *created;
+    u32 call;
+
+    for (call = 0; call <= MAX_LEVEL_UP_MOVES; call++)
+    {
+        u16 move = MonTryLearningNewMove(&mon, call == 0);
+        u16 expectedMove = OrigMonTryLearningNewMove(&expected, call == 0);
+
+        if (move != expectedMove)
+            FATAL_ERROR("MonTryLearningNewMove, species %u level %u call %u: returns 0x%X, expected 0x%X\n",
+                        species, level, call, move, expectedMove);
+        CheckSameMon(&mon, &expected, "MonTryLearningNewMove", species, level);
+        if (move == MOVE_NONE)
+            break;
+    }
+}
+
+static void CheckRelearner(const struct Pokemon *created, u32 species, u32 level)
+{
+    const u16 *learnset = gLevelUpLearnsets[species];
+    u32 numLearnsetMoves, trial, i;
+
+    for (numLearnsetMoves = 0; learnset[numLearnsetMoves] != LEVEL_UP_END; numLearnsetMoves++)
+        ;
+
+    for (trial = 0; trial < NUM_RELEARNER_TRIALS; trial++)
+    {
+        struct Pokemon mon = *created;
+        u16 moves[MAX_LEVEL_UP_MOVES];
+        u16 expectedMoves[MAX_LEVEL_UP_MOVES];
+        u8 numMoves, numExpected;
+
+        // The first trial keeps the moves the mon was created with.
+        for (i = 0; trial != 0 && i < MAX_MON_MOVES; i++)
+        {
+            u16 move;
+
+            switch (NextRandom() % 3)
+            {
+            case 0:
+                move = MOVE_NONE;
+                break;
+            case 1:
+                move = NextRandom() % MOVES_COUNT;
+                break;
+            default:
+                move = numLearnsetMoves != 0 ? learnset[NextRandom() % numLearnsetMoves] & LEVEL_UP_MOVE_ID : MOVE_NONE;
+                break;
+            }
+            SetMonData(&mon, MON_DATA_MOVE1 + i, &move);
+        }
+
+        numMoves = GetMoveRelearnerMoves(&mon, moves);
+        numExpected = OrigGetMoveRelearnerMoves(&mon, expectedMoves);
+        if (numMoves != numExpected || memcmp(moves, expectedMoves, numMoves * sizeof(moves[0])) != 0)
+            FATAL_ERROR("GetMoveRelearnerMoves, species %u level %u trial %u: %u moves, expected %u, or they differ\n",
+                        species, level, trial, numMoves, numExpected);
+
+        numMoves = GetNumberOfRelearnableMoves(&mon);
+        numExpected = OrigGetNumberOfRelearnableMoves(&mon);
+        if (numMoves != numExpected)
+            FATAL_ERROR("GetNumberOfRelearnableMoves, species %u level %u trial %u: %u moves, expected %u\n",
+                        species, level, trial, numMoves, numExpected);
+    }
+}
+
+static void CheckMons(void)
+{
+    u32 species, level;
+
+    for (species = SPECIES_NONE + 1; species < NUM_SPECIES; species++)
+    {
+        if (species == SPECIES_EGG)
+            continue;
+
+        for (level = 1; level <= MAX_LEVEL; level++)
+        {
+            struct Pokemon mon;
+
+            CreateMon(&mon, species, level, 0, TRUE, NextRandom(), OT_ID_PRESET, NextRandom());
+            CheckInitialMoveset(&mon, species, level);
+            CheckLearningNewMoves(&mon, species, level);
+            CheckRelearner(&mon, species, level);
+        }
+    }
+}
+
+static void CheckTMHMs(void)
+{
+    u32 species;
+
+    for (species = 0; species < NUM_SPECIES; species++)
+    {
+        u32 tm, count = 0;
+        u32 next = GetNextSpeciesTMHM(species, 0);
+
+        for (tm = 0; tm < NUM_TECHNICAL_MACHINES + NUM_HIDDEN_MACHINES; tm++)
+        {
+            if (!CanSpeciesLearnTMHM(species, tm))
+                continue;
+
+            if (next != tm)
+                FATAL_ERROR("GetNextSpeciesTMHM, species %u: gives TM/HM %u, expected %u\n", species, next, tm);
+            next = GetNextSpeciesTMHM(species, tm + 1);
+            count++;
+        }
+
+        if (next != NUM_TECHNICAL_MACHINES + NUM_HIDDEN_MACHINES)
+            FATAL_ERROR("GetNextSpeciesTMHM, species %u: gives TM/HM %u after the last one\n", species, next);
+        if (CountSpeciesTMHMs(species) != count)
+            FATAL_ERROR("CountSpeciesTMHMs, species %u: counts %u, expected %u\n", species, CountSpeciesTMHMs(species), count);
+    }
+}
+
+int main(void)
+{
+    CheckSorted();
+    printf("Learnsets: all %u sorted by level\n", NUM_SPECIES);
+
+    CheckCounts();
+    CheckMons();
+    printf("Level up moves: all species and levels match the original scans\n");
+
+    CheckTMHMs();
+    printf("TMs/HMs: all species match CanSpeciesLearnTMHM\n");
+
+    return 0;
+}
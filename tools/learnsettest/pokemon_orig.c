@@ -0,0 +1,164 @@
+// The level up learnset scans src/pokemon.c and src/apprentice.c used to do,
+// before they moved to the binary search in CountLevelUpMovesUpToLevel,
+// renamed with an Orig prefix. They are kept as the reference learnsettest
+// checks the current code against, so don't change them to match the game.
+//
+// This file is appended to src/pokemon.c by the Makefile, so it uses that
+// file's includes and can call its static functions.
+
+#include "pokemon_orig.h"
+
+static u8 sOrigLearningMoveTableID;
+
+// The scan both Apprentice functions did to find how many moves the
+// species knows by the given level.
+u8 OrigCountLevelUpMovesUpToLevel(u16 species, u8 level)
+{
+    const u16 *learnset = gLevelUpLearnsets[species];
+    u8 j;
+
+    for (j = 0; learnset[j] != LEVEL_UP_END; j++)
+    {
+        if ((learnset[j] & LEVEL_UP_MOVE_LV) > (level << 9))
+            break;
+    }
+
+    return j;
+}
+
+void OrigGiveBoxMonInitialMoveset(struct BoxPokemon *boxMon)
+{
+    u16 species = GetBoxMonData(boxMon, MON_DATA_SPECIES, NULL);
+    s32 level = GetLevelFromBoxMonExp(boxMon);
+    s32 i;
+
+    for (i = 0; gLevelUpLearnsets[species][i] != LEVEL_UP_END; i++)
+    {
+        u16 moveLevel;
+        u16 move;
+
+        moveLevel = (gLevelUpLearnsets[species][i] & LEVEL_UP_MOVE_LV);
+
+        if (moveLevel > (level << 9))
+            break;
+
+        move = (gLevelUpLearnsets[species][i] & LEVEL_UP_MOVE_ID);
+
+        if (GiveMoveToBoxMon(boxMon, move) == MON_HAS_MAX_MOVES)
+            DeleteFirstMoveAndGiveMoveToBoxMon(boxMon, move);
+    }
+}
+
+u16 OrigMonTryLearningNewMove(struct Pokemon *mon, bool8 firstMove)
+{
+    u32 retVal = MOVE_NONE;
+    u16 species = GetMonData(mon, MON_DATA_SPECIES, NULL);
+    u8 level = GetMonData(mon, MON_DATA_LEVEL, NULL);
+
+    // since you can learn more than one move per level
+    // the game needs to know whether you decided to
+    // learn it or keep the old set to avoid asking
+    // you to learn the same move over and over again
+    if (firstMove)
+    {
+        sOrigLearningMoveTableID = 0;
+
+        while ((gLevelUpLearnsets[species][sOrigLearningMoveTableID] & LEVEL_UP_MOVE_LV) != (level << 9))
+        {
+            sOrigLearningMoveTableID++;
+            if (gLevelUpLearnsets[species][sOrigLearningMoveTableID] == LEVEL_UP_END)
+                return MOVE_NONE;
+        }
+    }
+
+    if ((gLevelUpLearnsets[species][sOrigLearningMoveTableID] & LEVEL_UP_MOVE_LV) == (level << 9))
+    {
+        gMoveToLearn = (gLevelUpLearnsets[species][sOrigLearningMoveTableID] & LEVEL_UP_MOVE_ID);
+        sOrigLearningMoveTableID++;
+        retVal = GiveMoveToMon(mon, gMoveToLearn);
+    }
+
+    return retVal;
+}
+
+u8 OrigGetMoveRelearnerMoves(struct Pokemon *mon, u16 *moves)
+{
+    u16 learnedMoves[MAX_MON_MOVES];
+    u8 numMoves = 0;
+    u16 species = GetMonData(mon, MON_DATA_SPECIES, 0);
+    u8 level = GetMonData(mon, MON_DATA_LEVEL, 0);
+    int i, j, k;
+
+    for (i = 0; i < MAX_MON_MOVES; i++)
+        learnedMoves[i] = GetMonData(mon, MON_DATA_MOVE1 + i, 0);
+
+    for (i = 0; i < MAX_LEVEL_UP_MOVES; i++)
+    {
+        u16 moveLevel;
+
+        if (gLevelUpLearnsets[species][i] == LEVEL_UP_END)
+            break;
+
+        moveLevel = gLevelUpLearnsets[species][i] & LEVEL_UP_MOVE_LV;
+
+        if (moveLevel <= (level << 9))
+        {
+            for (j = 0; j < MAX_MON_MOVES && learnedMoves[j] != (gLevelUpLearnsets[species][i] & LEVEL_UP_MOVE_ID); j++)
+                ;
+
+            if (j == MAX_MON_MOVES)
+            {
+                for (k = 0; k < numMoves && moves[k] != (gLevelUpLearnsets[species][i] & LEVEL_UP_MOVE_ID); k++)
+                    ;
+
+                if (k == numMoves)
+                    moves[numMoves++] = gLevelUpLearnsets[species][i] & LEVEL_UP_MOVE_ID;
+            }
+        }
+    }
+
+    return numMoves;
+}
+
+u8 OrigGetNumberOfRelearnableMoves(struct Pokemon *mon)
+{
+    u16 learnedMoves[MAX_MON_MOVES];
+    u16 moves[MAX_LEVEL_UP_MOVES];
+    u8 numMoves = 0;
+    u16 species = GetMonData(mon, MON_DATA_SPECIES_OR_EGG, 0);
+    u8 level = GetMonData(mon, MON_DATA_LEVEL, 0);
+    int i, j, k;
+
+    if (species == SPECIES_EGG)
+        return 0;
+
+    for (i = 0; i < MAX_MON_MOVES; i++)
+        learnedMoves[i] = GetMonData(mon, MON_DATA_MOVE1 + i, 0);
+
+    for (i = 0; i < MAX_LEVEL_UP_MOVES; i++)
+    {
+        u16 moveLevel;
+
+        if (gLevelUpLearnsets[species][i] == LEVEL_UP_END)
+            break;
+
+        moveLevel = gLevelUpLearnsets[species][i] & LEVEL_UP_MOVE_LV;
+
+        if (moveLevel <= (level << 9))
+        {
+            for (j = 0; j < MAX_MON_MOVES && learnedMoves[j] != (gLevelUpLearnsets[species][i] & LEVEL_UP_MOVE_ID); j++)
+                ;
+
+            if (j == MAX_MON_MOVES)
+            {
+                for (k = 0; k < numMoves && moves[k] != (gLevelUpLearnsets[species][i] & LEVEL_UP_MOVE_ID); k++)
+                    ;
+
+                if (k == numMoves)
+                    moves[numMoves++] = gLevelUpLearnsets[species][i] & LEVEL_UP_MOVE_ID;
+            }
+        }
+    }
+
+    return numMoves;
+}
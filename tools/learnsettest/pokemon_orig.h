@@ -0,0 +1,10 @@
+#ifndef GUARD_POKEMON_ORIG_H
+#define GUARD_POKEMON_ORIG_H
+
+u8 OrigCountLevelUpMovesUpToLevel(u16 species, u8 level);
+void OrigGiveBoxMonInitialMoveset(struct BoxPokemon *boxMon);
+u16 OrigMonTryLearningNewMove(struct Pokemon *mon, bool8 firstMove);
+u8 OrigGetMoveRelearnerMoves(struct Pokemon *mon, u16 *moves);
+u8 OrigGetNumberOfRelearnableMoves(struct Pokemon *mon);
+
+#endif // GUARD_POKEMON_ORIG_H
@@ -0,0 +1,492 @@
+// mathtest - checks the division helpers in src/math_util.c against plain
+// division and times them on the host, checks the RNG helpers in
+// src/random.c against stepping the generator one call at a time, and
+// checks and times the fine and batch trig functions in src/trig.c.
+//
+// Usage:
+//   mathtest
+//       Exits with 1 after printing the first mismatch, if any.
+//
+// Checked exhaustively:
+//   - UDIV_CONST for every constant divisor the game uses, over every x
+//     with x * d < 2^32.
+//   - MathUtil_DivSmall for every d from 1 to 256 and every x below 2^24.
+// MathUtil_InitDivisor's magic numbers are checked against the 64-bit
+// division they're defined by, for every d below 2^20, around every power of
+// two, and on random divisors.
+// MathUtil_Divide is checked over every x below 2^20 for small divisors,
+// around multiples of divisors up to 0x4000, and on random divisors and
+// dividends over the whole u32 range.
+// AdvanceLcg is checked against stepping ISO_RANDOMIZE1 and ISO_RANDOMIZE2
+// one at a time, for up to 2^28 steps and across the full 2^32 period.
+// RandomFill is checked against the same number of Random() calls, for the
+// values it writes and the state it leaves.
+// SinFine and CosFine are checked against libm's sin for every angle, and
+// must stay within MAX_FINE_ERROR Q4.12 steps of it. SinCosFine must give
+// the same pair as SinFine and CosFine. SinBatch_C and SinCosBatch_C, the C
+// versions of the ARM routines in src/trig_batch.s, must give what calling
+// Sin and Cos once per line does, on random indexes, steps and amplitudes.
+//
+// The GBA has no divide instruction, so the benchmark compares the helpers
+// against a shift-and-subtract division like the one libgcc uses there. The
+// timings are host timings and only show the relative cost. The same goes
+// for the trig timings: the ARM batch routines run from IWRAM on the GBA and
+// can't be timed here, so SinBatch_C stands in for them.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef int16_t s16;
+typedef int32_t s32;
+typedef int64_t s64;
+
+#include "math_util.h"
+#include "random.h"
+#include "trig.h"
+
+#define FATAL_ERROR(format, ...)            \
+do                                          \
+{                                           \
+    fprintf(stderr, format, ##__VA_ARGS__); \
+    exit(1);                                \
+} while (0)
+
+#define BENCH_COUNT 50000000
+#define TRIG_BENCH_COUNT 200000
+
+// Largest difference from the exact sine SinFine and CosFine may have, in
+// Q4.12 steps. The table entries are rounded to the nearest step, and
+// interpolating between them adds at most one more.
+#define MAX_FINE_ERROR 2
+
+#define PI 3.14159265358979323846
+
+// DISPLAY_HEIGHT in the game
+#define NUM_SCANLINES 160
+
+// The game gets this from m4a_1.s.
+u32 umul3232H32(u32 multiplier, u32 multiplicand)
+{
+    return ((u64)multiplier * multiplicand) >> 32;
+}
+
+static u32 sRngState = 0x12345678;
+
+static u32 NextRandom(void)
+{
+    sRngState ^= sRngState << 13;
+    sRngState ^= sRngState >> 17;
+    sRngState ^= sRngState << 5;
+    return sRngState;
+}
+
+// The constant divisors passed to UDIV_CONST in the game.
+static void CheckConstantDivisors(void)
+{
+    static const u32 divisors[] = { 5, 100 };
+    unsigned i;
+
+    for (i = 0; i < sizeof(divisors) / sizeof(divisors[0]); i++)
+    {
+        u32 d = divisors[i];
+        u32 magic = DIV_MAGIC(d);
+        u32 maxX = 0xFFFFFFFF / d;
+        u32 x;
+
+        for (x = 0; ; x++)
+        {
+            if (umul3232H32(x, magic) != x / d)
+                FATAL_ERROR("UDIV_CONST(%u, %u) = %u, expected %u\n", x, d, umul3232H32(x, magic), x / d);
+            if (x == maxX)
+                break;
+        }
+        printf("UDIV_CONST: d = %u exact for all x <= %u\n", d, maxX);
+    }
+}
+
+static void CheckDivSmall(void)
+{
+    u32 d, x;
+
+    for (d = 1; d <= 256; d++)
+    {
+        for (x = 0; x < (1 << 24); x++)
+        {
+            if (MathUtil_DivSmall(x, d) != x / d)
+                FATAL_ERROR("MathUtil_DivSmall(%u, %u) = %u, expected %u\n", x, d, MathUtil_DivSmall(x, d), x / d);
+        }
+    }
+    printf("MathUtil_DivSmall: exact for 1 <= d <= 256, x < 2^24\n");
+}
+
+static void CheckInitDivisorOne(u32 d)
+{
+    struct Divisor div;
+    u32 bits = 0;
+    u32 expected;
+
+    while (bits < 32 && ((u64)1 << bits) < d)
+        bits++;
+    expected = ((((u64)1 << bits) - d) << 32) / d + 1;
+
+    MathUtil_InitDivisor(&div, d);
+    if (div.magic != expected)
+        FATAL_ERROR("MathUtil_InitDivisor(%u): magic 0x%08X, expected 0x%08X\n", d, div.magic, expected);
+}
+
+static void CheckInitDivisor(void)
+{
+    u32 d, i;
+
+    for (d = 1; d < (1 << 20); d++)
+        CheckInitDivisorOne(d);
+
+    for (i = 1; i < 32; i++)
+    {
+        CheckInitDivisorOne((1u << i) - 1);
+        CheckInitDivisorOne(1u << i);
+        CheckInitDivisorOne((1u << i) + 1);
+    }
+    CheckInitDivisorOne(0xFFFFFFFF);
+
+    for (i = 0; i < 10000000; i++)
+    {
+        d = NextRandom() >> (NextRandom() % 32);
+        if (d != 0)
+            CheckInitDivisorOne(d);
+    }
+    printf("MathUtil_InitDivisor: matches the 64-bit division on all checked divisors\n");
+}
+
+static void CheckDivideOne(const struct Divisor *div, u32 d, u32 x)
+{
+    if (MathUtil_Divide(div, x) != x / d)
+        FATAL_ERROR("MathUtil_Divide(%u) by %u = %u, expected %u\n", x, d, MathUtil_Divide(div, x), x / d);
+}
+
+static void CheckDivide(void)
+{
+    struct Divisor div;
+    u32 d, x, i;
+
+    for (d = 1; d <= 64; d++)
+    {
+        MathUtil_InitDivisor(&div, d);
+        for (x = 0; x < (1 << 20); x++)
+            CheckDivideOne(&div, d, x);
+    }
+
+    // A few thousand multiples spread over the whole range for each divisor
+    for (d = 1; d <= 0x4000; d++)
+    {
+        u64 multiple;
+        u64 stride = (u64)d * (0x100000000 / d / 4096 + 1);
+
+        MathUtil_InitDivisor(&div, d);
+        CheckDivideOne(&div, d, 0xFFFFFFFF);
+        CheckDivideOne(&div, d, 0xFFFFFFFE);
+        for (multiple = d; multiple <= 0xFFFFFFFF; multiple += stride)
+        {
+            CheckDivideOne(&div, d, multiple - 1);
+            CheckDivideOne(&div, d, multiple);
+            if (multiple < 0xFFFFFFFF)
+                CheckDivideOne(&div, d, multiple + 1);
+        }
+    }
+
+    for (i = 0; i < 10000000; i++)
+    {
+        // Favour small divisors, like the battle bar maximums.
+        d = NextRandom() >> (NextRandom() % 32);
+        if (d == 0)
+            d = 1;
+        x = NextRandom();
+        MathUtil_InitDivisor(&div, d);
+        CheckDivideOne(&div, d, x);
+        CheckDivideOne(&div, d, x >> (x % 32));
+    }
+    printf("MathUtil_Divide: exact on all checked divisors\n");
+}
+
+#define NUM_LCG_STEPS (1 << 28)
+
+static void CheckAdvanceLcgOne(u32 seed, u32 increment, u32 steps, u32 expected)
+{
+    u32 value = AdvanceLcg(seed, 1103515245, increment, steps);
+
+    if (value != expected)
+        FATAL_ERROR("AdvanceLcg(0x%08X, increment %u, %u steps) = 0x%08X, expected 0x%08X\n",
+                    seed, increment, steps, value, expected);
+}
+
+static void CheckAdvanceLcg(void)
+{
+    u32 seed = NextRandom();
+    u32 value1 = seed, value2 = seed;
+    u32 steps, i;
+
+    // Every step count up to NUM_LCG_STEPS for one seed, then the powers of
+    // two only, which is where each squaring in AdvanceLcg gets used.
+    for (steps = 0; steps <= NUM_LCG_STEPS; steps++)
+    {
+        if (steps < 0x10000 || (steps & (steps - 1)) == 0)
+        {
+            CheckAdvanceLcgOne(seed, 24691, steps, value1);
+            CheckAdvanceLcgOne(seed, 12345, steps, value2);
+        }
+        value1 = ISO_RANDOMIZE1(value1);
+        value2 = ISO_RANDOMIZE2(value2);
+    }
+
+    for (i = 0; i < 1000000; i++)
+    {
+        u32 a = NextRandom() >> (NextRandom() % 32);
+        u32 b = NextRandom() >> (NextRandom() % 32);
+
+        seed = NextRandom();
+        if (ISO_RANDOMIZE2_N(seed, a + b) != ISO_RANDOMIZE2_N(ISO_RANDOMIZE2_N(seed, a), b))
+            FATAL_ERROR("ISO_RANDOMIZE2_N(0x%08X, %u + %u) differs from stepping %u then %u\n", seed, a, b, a, b);
+
+        // Both generators have a period of 2^32, so one more step after
+        // 2^32 - 1 gets back to the seed.
+        CheckAdvanceLcgOne(ISO_RANDOMIZE1(seed), 24691, 0xFFFFFFFF, seed);
+        CheckAdvanceLcgOne(ISO_RANDOMIZE2(seed), 12345, 0xFFFFFFFF, seed);
+    }
+    printf("AdvanceLcg: matches stepping one at a time, up to %u steps and over the full period\n", NUM_LCG_STEPS);
+}
+
+static void CheckRandomFill(void)
+{
+    u16 values[256];
+    u32 count, i, trial;
+
+    for (trial = 0; trial < 10000; trial++)
+    {
+        u32 seed = NextRandom();
+        u32 endValue;
+
+        count = trial < 256 ? trial : NextRandom() % 256;
+        gRngValue = seed;
+        RandomFill(values, count);
+        endValue = gRngValue;
+
+        gRngValue = seed;
+        for (i = 0; i < count; i++)
+        {
+            u16 expected = Random();
+
+            if (values[i] != expected)
+                FATAL_ERROR("RandomFill from 0x%08X: value %u of %u is 0x%04X, expected 0x%04X\n",
+                            seed, i, count, values[i], expected);
+        }
+        if (endValue != gRngValue)
+            FATAL_ERROR("RandomFill from 0x%08X, %u values: leaves the RNG at 0x%08X, expected 0x%08X\n",
+                        seed, count, endValue, gRngValue);
+    }
+    printf("RandomFill: matches calling Random() for up to 255 values\n");
+}
+
+static void CheckSinFine(void)
+{
+    double maxSinError = 0, maxFineError = 0;
+    u32 angle;
+
+    for (angle = 0; angle <= 0xFFFF; angle++)
+    {
+        double exact = sin(angle * (2 * PI / 0x10000)) * 4096;
+        double exactCos = cos(angle * (2 * PI / 0x10000)) * 4096;
+        s16 sinValue = SinFine(angle), cosValue = CosFine(angle);
+        s16 pairSin, pairCos;
+
+        if (fabs(sinValue - exact) > MAX_FINE_ERROR)
+            FATAL_ERROR("SinFine(0x%04X) = %d, expected %.2f\n", angle, sinValue, exact);
+        if (fabs(cosValue - exactCos) > MAX_FINE_ERROR)
+            FATAL_ERROR("CosFine(0x%04X) = %d, expected %.2f\n", angle, cosValue, exactCos);
+        maxFineError = fmax(maxFineError, fmax(fabs(sinValue - exact), fabs(cosValue - exactCos)));
+
+        SinCosFine(angle, &pairSin, &pairCos);
+        if (pairSin != sinValue || pairCos != cosValue)
+            FATAL_ERROR("SinCosFine(0x%04X) = (%d, %d), expected (%d, %d)\n", angle, pairSin, pairCos, sinValue, cosValue);
+
+        // Sin's 256 steps per turn, at the same scale, to compare against.
+        if (angle % 0x100 == 0)
+            maxSinError = fmax(maxSinError, fabs(Sin(angle >> 8, 0x1000) - exact));
+    }
+    printf("SinFine/CosFine: within %.2f of the exact value at Q4.12 for every angle, Sin is within %.2f on its own steps\n",
+           maxFineError, maxSinError);
+}
+
+static void CheckSinBatch(void)
+{
+    static s16 values[2 * 320];
+    u32 trial, i;
+
+    for (trial = 0; trial < 100000; trial++)
+    {
+        u32 count = NextRandom() % 321;
+        u16 index = NextRandom();
+        u16 step = (trial % 2 == 0) ? NextRandom() : NextRandom() % 0x800;
+        s16 amplitude = NextRandom() >> (NextRandom() % 32);
+
+        SinBatch_C(values, count, index, step, amplitude);
+        for (i = 0; i < count; i++)
+        {
+            u16 n = (u16)(index + i * step) >> 8;
+
+            if (values[i] != Sin(n, amplitude))
+                FATAL_ERROR("SinBatch_C(0x%04X, step 0x%04X, amplitude %d): value %u is %d, expected %d\n",
+                            index, step, amplitude, i, values[i], Sin(n, amplitude));
+        }
+
+        SinCosBatch_C(values, count, index, step, amplitude);
+        for (i = 0; i < count; i++)
+        {
+            u16 n = (u16)(index + i * step) >> 8;
+
+            if (values[2 * i] != Sin(n, amplitude) || values[2 * i + 1] != Cos(n, amplitude))
+                FATAL_ERROR("SinCosBatch_C(0x%04X, step 0x%04X, amplitude %d): pair %u is (%d, %d), expected (%d, %d)\n",
+                            index, step, amplitude, i, values[2 * i], values[2 * i + 1], Sin(n, amplitude), Cos(n, amplitude));
+        }
+    }
+    printf("SinBatch_C/SinCosBatch_C: match Sin and Cos on all checked runs\n");
+}
+
+// Unsigned division as done in software on a CPU without a divider.
+static u32 SoftDivide(u32 x, u32 d)
+{
+    u32 quotient = 0;
+    u32 bit = 1;
+
+    while (d < x && !(d & 0x80000000))
+    {
+        d <<= 1;
+        bit <<= 1;
+    }
+    while (bit != 0)
+    {
+        if (x >= d)
+        {
+            x -= d;
+            quotient |= bit;
+        }
+        d >>= 1;
+        bit >>= 1;
+    }
+    return quotient;
+}
+
+static double Seconds(clock_t start)
+{
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+static void Benchmark(void)
+{
+    static u32 values[1024];
+    struct Divisor div;
+    volatile u32 sink = 0;
+    u32 d = 999;
+    clock_t start;
+    double soft, divide, constant;
+    u32 i;
+
+    for (i = 0; i < 1024; i++)
+        values[i] = NextRandom() % 1000000;
+
+    MathUtil_InitDivisor(&div, d);
+
+    start = clock();
+    for (i = 0; i < BENCH_COUNT; i++)
+        sink += SoftDivide(values[i & 1023], d);
+    soft = Seconds(start);
+
+    start = clock();
+    for (i = 0; i < BENCH_COUNT; i++)
+        sink += MathUtil_Divide(&div, values[i & 1023]);
+    divide = Seconds(start);
+
+    start = clock();
+    for (i = 0; i < BENCH_COUNT; i++)
+        sink += UDIV_CONST(values[i & 1023] & 0xFFFF, 100);
+    constant = Seconds(start);
+
+    printf("benchmark, %d calls each:\n", BENCH_COUNT);
+    printf("  software division:  %.2f ns/call\n", soft * 1e9 / BENCH_COUNT);
+    printf("  MathUtil_Divide:    %.2f ns/call\n", divide * 1e9 / BENCH_COUNT);
+    printf("  UDIV_CONST:         %.2f ns/call\n", constant * 1e9 / BENCH_COUNT);
+    (void)sink;
+}
+
+// A battle transition's 160 scanline offsets, per call, the way the game
+// used to fill them and with the batch function.
+static void TrigBenchmark(void)
+{
+    static s16 lines[NUM_SCANLINES];
+    volatile s32 sink = 0;
+    clock_t start;
+    double loop, batch, separate, pair;
+    u32 i, j;
+
+    start = clock();
+    for (i = 0; i < TRIG_BENCH_COUNT; i++)
+    {
+        u16 sinVal = i;
+
+        for (j = 0; j < NUM_SCANLINES; j++, sinVal += 0x180)
+            lines[j] = Sin(sinVal >> 8, 40);
+        sink += lines[i % NUM_SCANLINES];
+    }
+    loop = Seconds(start);
+
+    start = clock();
+    for (i = 0; i < TRIG_BENCH_COUNT; i++)
+    {
+        SinBatch_C(lines, NUM_SCANLINES, i, 0x180, 40);
+        sink += lines[i % NUM_SCANLINES];
+    }
+    batch = Seconds(start);
+
+    start = clock();
+    for (i = 0; i < TRIG_BENCH_COUNT * NUM_SCANLINES; i++)
+        sink += SinFine(i * 97) + CosFine(i * 97);
+    separate = Seconds(start);
+
+    start = clock();
+    for (i = 0; i < TRIG_BENCH_COUNT * NUM_SCANLINES; i++)
+    {
+        s16 sinValue, cosValue;
+
+        SinCosFine(i * 97, &sinValue, &cosValue);
+        sink += sinValue + cosValue;
+    }
+    pair = Seconds(start);
+
+    printf("trig benchmark, %d runs of %d lines each:\n", TRIG_BENCH_COUNT, NUM_SCANLINES);
+    printf("  Sin per line:          %.2f ns/run\n", loop * 1e9 / TRIG_BENCH_COUNT);
+    printf("  SinBatch_C:            %.2f ns/run\n", batch * 1e9 / TRIG_BENCH_COUNT);
+    printf("  SinFine + CosFine:     %.2f ns/run\n", separate * 1e9 / TRIG_BENCH_COUNT);
+    printf("  SinCosFine:            %.2f ns/run\n", pair * 1e9 / TRIG_BENCH_COUNT);
+    (void)sink;
+}
+
+int main(void)
+{
+    CheckConstantDivisors();
+    CheckDivSmall();
+    CheckInitDivisor();
+    CheckDivide();
+    CheckAdvanceLcg();
+    CheckRandomFill();
+    CheckSinFine();
+    CheckSinBatch();
+    Benchmark();
+    TrigBenchmark();
+    return 0;
+}
@@ -0,0 +1,15 @@
+// Entry points for partybench to the static functions in
+// src/battle_factory.c. Like factory_orig.c, this is appended to that file by
+// the Makefile.
+
+#include "factory_exports.h"
+
+void NewGenerateOpponentMons(void)
+{
+    GenerateOpponentMons();
+}
+
+void NewGenerateInitialRentalMons(void)
+{
+    GenerateInitialRentalMons();
+}
@@ -0,0 +1,7 @@
+#ifndef GUARD_FACTORY_EXPORTS_H
+#define GUARD_FACTORY_EXPORTS_H
+
+void NewGenerateOpponentMons(void);
+void NewGenerateInitialRentalMons(void);
+
+#endif // GUARD_FACTORY_EXPORTS_H
@@ -0,0 +1,179 @@
+// The Battle Factory generators from before they used FrontierPartyExclusions,
+// renamed with an Orig prefix. They are kept as the reference partybench
+// checks and times the current code against, so don't change them to match
+// the game.
+//
+// This file is appended to src/battle_factory.c by the Makefile, so it uses
+// that file's includes and can call its static functions.
+
+#include "factory_orig.h"
+
+void OrigGenerateOpponentMons(void)
+{
+    int i, j, k;
+    u16 species[FRONTIER_PARTY_SIZE];
+    u16 heldItems[FRONTIER_PARTY_SIZE];
+    int firstMonId = 0;
+    u16 trainerId = 0;
+    u32 lvlMode = gSaveBlock2Ptr->frontier.lvlMode;
+    u32 battleMode = VarGet(VAR_FRONTIER_BATTLE_MODE);
+    u32 winStreak = gSaveBlock2Ptr->frontier.factoryWinStreaks[battleMode][lvlMode];
+    u32 challengeNum = winStreak / FRONTIER_STAGES_PER_CHALLENGE;
+    gFacilityTrainers = gBattleFrontierTrainers;
+
+    do
+    {
+        // Choose a random trainer, ensuring no repeats in this challenge
+        trainerId = GetRandomScaledFrontierTrainerId(challengeNum, gSaveBlock2Ptr->frontier.curChallengeBattleNum);
+        for (i = 0; i < gSaveBlock2Ptr->frontier.curChallengeBattleNum; i++)
+        {
+            if (gSaveBlock2Ptr->frontier.trainerIds[i] == trainerId)
+                break;
+        }
+    } while (i != gSaveBlock2Ptr->frontier.curChallengeBattleNum);
+
+    gTrainerBattleOpponent_A = trainerId;
+    if (gSaveBlock2Ptr->frontier.curChallengeBattleNum < FRONTIER_STAGES_PER_CHALLENGE - 1)
+        gSaveBlock2Ptr->frontier.trainerIds[gSaveBlock2Ptr->frontier.curChallengeBattleNum] = trainerId;
+
+    i = 0;
+    while (i != FRONTIER_PARTY_SIZE)
+    {
+        u16 monId = GetFactoryMonId(lvlMode, challengeNum, FALSE);
+
+        // Unown (FRONTIER_MON_UNOWN) is forbidden on opponent Factory teams.
+        if (gFacilityTrainerMons[monId].species == SPECIES_UNOWN)
+            continue;
+
+        // Ensure none of the opponent's Pokémon are the same as the potential rental Pokémon for the player
+        for (j = 0; j < (int)ARRAY_COUNT(gSaveBlock2Ptr->frontier.rentalMons); j++)
+        {
+            if (gFacilityTrainerMons[monId].species == gFacilityTrainerMons[gSaveBlock2Ptr->frontier.rentalMons[j].monId].species)
+                break;
+        }
+        if (j != (int)ARRAY_COUNT(gSaveBlock2Ptr->frontier.rentalMons))
+            continue;
+
+        // "High tier" Pokémon are only allowed on open level mode
+        if (lvlMode == FRONTIER_LVL_50 && monId > FRONTIER_MONS_HIGH_TIER)
+            continue;
+
+        // Ensure this species hasn't already been chosen for the opponent
+        for (k = firstMonId; k < firstMonId + i; k++)
+        {
+            if (species[k] == gFacilityTrainerMons[monId].species)
+                break;
+        }
+        if (k != firstMonId + i)
+            continue;
+
+        // Ensure held items don't repeat on the opponent's team
+        for (k = firstMonId; k < firstMonId + i; k++)
+        {
+            if (heldItems[k] != ITEM_NONE && heldItems[k] == gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId])
+                break;
+        }
+        if (k != firstMonId + i)
+            continue;
+
+        // Successful selection
+        species[i] = gFacilityTrainerMons[monId].species;
+        heldItems[i] = gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId];
+        gFrontierTempParty[i] = monId;
+        i++;
+    }
+}
+
+void OrigGenerateInitialRentalMons(void)
+{
+    int i, j;
+    u8 firstMonId;
+    u8 battleMode;
+    u8 lvlMode;
+    u8 challengeNum;
+    u8 factoryLvlMode;
+    u8 factoryBattleMode;
+    u8 rentalRank;
+    u16 monId;
+    u16 currSpecies;
+    u16 species[PARTY_SIZE];
+    u16 monIds[PARTY_SIZE];
+    u16 heldItems[PARTY_SIZE];
+
+    gFacilityTrainers = gBattleFrontierTrainers;
+    for (i = 0; i < PARTY_SIZE; i++)
+    {
+        species[i] = SPECIES_NONE;
+        monIds[i] = 0;
+        heldItems[i] = ITEM_NONE;
+    }
+    lvlMode = gSaveBlock2Ptr->frontier.lvlMode;
+    battleMode = VarGet(VAR_FRONTIER_BATTLE_MODE);
+    challengeNum = gSaveBlock2Ptr->frontier.factoryWinStreaks[battleMode][lvlMode] / FRONTIER_STAGES_PER_CHALLENGE;
+    if (VarGet(VAR_FRONTIER_BATTLE_MODE) == FRONTIER_MODE_DOUBLES)
+        factoryBattleMode = FRONTIER_MODE_DOUBLES;
+    else
+        factoryBattleMode = FRONTIER_MODE_SINGLES;
+
+    gFacilityTrainerMons = gBattleFrontierMons;
+    if (gSaveBlock2Ptr->frontier.lvlMode != FRONTIER_LVL_50)
+    {
+        factoryLvlMode = FRONTIER_LVL_OPEN;
+        firstMonId = 0;
+    }
+    else
+    {
+        factoryLvlMode = FRONTIER_LVL_50;
+        firstMonId = 0;
+    }
+    rentalRank = GetNumPastRentalsRank(factoryBattleMode, factoryLvlMode);
+
+    currSpecies = SPECIES_NONE;
+    i = 0;
+    while (i != PARTY_SIZE)
+    {
+        if (i < rentalRank) // The more times the player has rented, the more initial rentals are generated from a better set of Pokémon
+            monId = GetFactoryMonId(factoryLvlMode, challengeNum, TRUE);
+        else
+            monId = GetFactoryMonId(factoryLvlMode, challengeNum, FALSE);
+
+        if (gFacilityTrainerMons[monId].species == SPECIES_UNOWN)
+            continue;
+
+        // Cannot have two Pokémon of the same species.
+        for (j = firstMonId; j < firstMonId + i; j++)
+        {
+            u16 existingMonId = monIds[j];
+            if (existingMonId == monId)
+                break;
+            if (species[j] == gFacilityTrainerMons[monId].species)
+            {
+                if (currSpecies == SPECIES_NONE)
+                    currSpecies = gFacilityTrainerMons[monId].species;
+                else
+                    break;
+            }
+        }
+        if (j != firstMonId + i)
+            continue;
+
+        // Cannot have two same held items.
+        for (j = firstMonId; j < firstMonId + i; j++)
+        {
+            if (heldItems[j] != ITEM_NONE && heldItems[j] == gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId])
+            {
+                if (gFacilityTrainerMons[monId].species == currSpecies)
+                    currSpecies = SPECIES_NONE;
+                break;
+            }
+        }
+        if (j != firstMonId + i)
+            continue;
+
+        gSaveBlock2Ptr->frontier.rentalMons[i].monId = monId;
+        species[i] = gFacilityTrainerMons[monId].species;
+        heldItems[i] = gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId];
+        monIds[i] = monId;
+        i++;
+    }
+}
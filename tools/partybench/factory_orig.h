@@ -0,0 +1,7 @@
+#ifndef GUARD_FACTORY_ORIG_H
+#define GUARD_FACTORY_ORIG_H
+
+void OrigGenerateOpponentMons(void);
+void OrigGenerateInitialRentalMons(void);
+
+#endif // GUARD_FACTORY_ORIG_H
@@ -0,0 +1,17 @@
+// The frontier trainer, mon and held item tables, built from the game's data
+// headers the same way src/battle_tower.c includes them.
+
+#include "global.h"
+#include "battle_tower.h"
+#include "constants/battle_frontier.h"
+#include "constants/battle_frontier_mons.h"
+#include "constants/battle_frontier_trainers.h"
+#include "constants/easy_chat.h"
+#include "constants/items.h"
+#include "constants/moves.h"
+#include "constants/trainers.h"
+
+#include "data/battle_frontier/battle_frontier_held_items.h"
+#include "data/battle_frontier/battle_frontier_trainer_mons.h"
+#include "data/battle_frontier/battle_frontier_trainers.h"
+#include "data/battle_frontier/battle_frontier_mons.h"
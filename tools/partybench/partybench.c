@@ -0,0 +1,549 @@
+// partybench - times how the Battle Tower and Battle Factory pick a random
+// frontier team, using the game's trainer data and its own party code
+// (src/frontier_party.c and src/battle_factory.c).
+//
+// Usage:
+//   partybench
+//       Exits with 1 if a party differs from the original game's for the same
+//       RNG state where it must match, or if any party repeats a species or
+//       held item.
+//
+// Tower: for every frontier trainer, in level 50 and open level mode, a party
+// of 3 is picked alone and after a partner's party of 3 from the next trainer.
+// Each is done three ways:
+//   rescan  - the original game: redraw until a pick's species and held item
+//             aren't in the party so far, found by looping over the party.
+//   bitset  - the default build: the same draws, rejected through
+//             FrontierPartyExclusions, stopping if the set runs out.
+//   direct  - FRONTIER_PARTY_DIRECT_DRAW: draw from the candidates that are
+//             left with DrawFrontierPartyCandidate.
+// The rescan here reads plain arrays; the original game calls GetMonData twice
+// per party member on every draw, which decrypts the mon each time, so its
+// real cost is higher than the rescan timing shows.
+//
+// Factory: for both level modes, every challenge number and the lowest and
+// highest rental ranks, the initial rentals and then the opponent's party are
+// generated by the original functions (factory_orig.c) and the current ones.
+// Both must give the same Pokémon.
+//
+// Each party is timed on its own, taking the fastest of NUM_TIMING_RUNS, and
+// the mean and worst times and Random() calls are printed per facility.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "global.h"
+#include "battle_tower.h"
+#include "frontier_party.h"
+#include "random.h"
+#include "constants/battle_frontier.h"
+#include "constants/battle_frontier_mons.h"
+#include "constants/battle_frontier_trainers.h"
+#include "constants/items.h"
+#include "constants/species.h"
+#include "constants/vars.h"
+#include "factory_orig.h"
+#include "factory_exports.h"
+
+#define FATAL_ERROR(format, ...)            \
+do                                          \
+{                                           \
+    fprintf(stderr, format, ##__VA_ARGS__); \
+    exit(1);                                \
+} while (0)
+
+#define PICKS_PER_TRAINER 3
+#define MAX_PARTY_MONS (PICKS_PER_TRAINER * 2)
+#define TOWER_SEEDS 2000
+#define FACTORY_SEEDS 2000
+#define NUM_TIMING_RUNS 3
+
+// The original game loops forever on a set that runs out. The rescan gives up
+// after this many draws instead, far more than any real party needs.
+#define MAX_RESCAN_DRAWS 100000
+
+enum
+{
+    METHOD_RESCAN,
+    METHOD_BITSET,
+    METHOD_DIRECT,
+    METHOD_COUNT,
+};
+
+static const char *const sMethodNames[METHOD_COUNT] = { "rescan", "bitset", "direct" };
+
+struct Party
+{
+    u16 monIds[MAX_PARTY_MONS];
+    u8 count;
+};
+
+struct Stats
+{
+    unsigned long long parties;
+    unsigned long long randomCalls;
+    unsigned maxRandomCalls;
+    double nanoseconds;
+    double maxNanoseconds;
+};
+
+static struct SaveBlock2 sSaveBlock2;
+
+struct SaveBlock2 *gSaveBlock2Ptr = &sSaveBlock2;
+
+// The game data the party code uses, which battle_tower.c would define.
+const struct BattleFrontierTrainer *gFacilityTrainers;
+const struct FacilityMon *gFacilityTrainerMons;
+u16 gFrontierTempParty[MAX_FRONTIER_PARTY_SIZE];
+u16 gTrainerBattleOpponent_A;
+
+static u32 sRngValue;
+static unsigned sRandomCalls;
+
+// The game functions the party code calls.
+u16 Random(void)
+{
+    sRngValue = ISO_RANDOMIZE1(sRngValue);
+    sRandomCalls++;
+    return sRngValue >> 16;
+}
+
+u16 VarGet(u16 id)
+{
+    if (id != VAR_FRONTIER_BATTLE_MODE)
+        FATAL_ERROR("VarGet called with unexpected var 0x%X\n", id);
+    return FRONTIER_MODE_SINGLES;
+}
+
+// The trainer doesn't change which Pokémon the Factory picks, so this doesn't
+// use Random() and every challenge gets the same one.
+u16 GetRandomScaledFrontierTrainerId(u8 challengeNum, u8 battleNum)
+{
+    return challengeNum + battleNum;
+}
+
+static double GetNanoseconds(void)
+{
+    struct timespec time;
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec * 1e9 + time.tv_nsec;
+}
+
+static void AddToStats(struct Stats *stats, unsigned randomCalls, double nanoseconds)
+{
+    stats->parties++;
+    stats->randomCalls += randomCalls;
+    stats->maxRandomCalls = max(stats->maxRandomCalls, randomCalls);
+    stats->nanoseconds += nanoseconds;
+    stats->maxNanoseconds = max(stats->maxNanoseconds, nanoseconds);
+}
+
+static void PrintStats(const char *name, const struct Stats *stats)
+{
+    printf("  %-22s  %5.2f Random() calls/party (worst %3u)  %7.1f ns/party (worst %7.1f)\n",
+           name,
+           (double)stats->randomCalls / stats->parties,
+           stats->maxRandomCalls,
+           stats->nanoseconds / stats->parties,
+           stats->maxNanoseconds);
+}
+
+static u16 GetSpecies(u16 monId)
+{
+    return gFacilityTrainerMons[monId].species;
+}
+
+static u16 GetHeldItem(u16 monId)
+{
+    return gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId];
+}
+
+static u8 CountMonSet(const u16 *monSet)
+{
+    u8 bfMonCount;
+
+    for (bfMonCount = 0; monSet[bfMonCount] != 0xFFFF; bfMonCount++)
+        ;
+    return bfMonCount;
+}
+
+static void ExcludeParty(struct FrontierPartyExclusions *exclusions, const struct Party *party)
+{
+    int i;
+
+    ClearFrontierPartyExclusions(exclusions);
+    for (i = 0; i < party->count; i++)
+        AddFrontierPartyExclusion(exclusions, GetSpecies(party->monIds[i]), GetHeldItem(party->monIds[i]));
+}
+
+// Returns FALSE if the set ran out.
+static bool32 PickRescan(struct Party *party, const u16 *monSet, bool32 lvl50)
+{
+    u8 bfMonCount = CountMonSet(monSet);
+    u8 firstMonId = party->count;
+    u32 draws = 0;
+    int i, j;
+
+    i = 0;
+    while (i != PICKS_PER_TRAINER)
+    {
+        u16 monId = monSet[Random() % bfMonCount];
+
+        if (++draws > MAX_RESCAN_DRAWS)
+            return FALSE;
+        if (lvl50 && monId > FRONTIER_MONS_HIGH_TIER)
+            continue;
+
+        for (j = 0; j < i + firstMonId; j++)
+        {
+            if (GetSpecies(party->monIds[j]) == GetSpecies(monId))
+                break;
+        }
+        if (j != i + firstMonId)
+            continue;
+
+        for (j = 0; j < i + firstMonId; j++)
+        {
+            if (GetHeldItem(party->monIds[j]) != ITEM_NONE && GetHeldItem(party->monIds[j]) == GetHeldItem(monId))
+                break;
+        }
+        if (j != i + firstMonId)
+            continue;
+
+        party->monIds[party->count++] = monId;
+        i++;
+    }
+    return TRUE;
+}
+
+// The same as FillTrainerParty's default build.
+static bool32 PickWithExclusions(struct Party *party, const u16 *monSet, bool32 lvl50)
+{
+    struct FrontierPartyExclusions exclusions;
+    u8 bfMonCount = CountMonSet(monSet);
+    u8 numRejected = 0;
+    int i;
+
+    ExcludeParty(&exclusions, party);
+
+    i = 0;
+    while (i != PICKS_PER_TRAINER)
+    {
+        u16 monId = monSet[Random() % bfMonCount];
+
+        if ((lvl50 && monId > FRONTIER_MONS_HIGH_TIER) || IsFrontierMonExcluded(&exclusions, monId))
+        {
+            if (++numRejected == bfMonCount)
+            {
+                if (!CanAnyFrontierMonJoinParty(&exclusions, monSet, bfMonCount, lvl50))
+                    break;
+                numRejected = 0;
+            }
+            continue;
+        }
+
+        AddFrontierPartyExclusion(&exclusions, GetSpecies(monId), GetHeldItem(monId));
+        party->monIds[party->count++] = monId;
+        i++;
+    }
+    return i == PICKS_PER_TRAINER;
+}
+
+// The same as FillTrainerParty with FRONTIER_PARTY_DIRECT_DRAW.
+static bool32 PickDirect(struct Party *party, const u16 *monSet, bool32 lvl50)
+{
+    struct FrontierPartyExclusions exclusions;
+    u8 candidates[UCHAR_MAX];
+    u8 numCandidates = InitFrontierPartyCandidates(candidates, monSet, lvl50);
+    int i;
+
+    ExcludeParty(&exclusions, party);
+
+    i = 0;
+    while (i != PICKS_PER_TRAINER)
+    {
+        u16 monId = DrawFrontierPartyCandidate(&exclusions, monSet, candidates, &numCandidates);
+
+        if (monId == 0xFFFF)
+            break;
+        AddFrontierPartyExclusion(&exclusions, GetSpecies(monId), GetHeldItem(monId));
+        party->monIds[party->count++] = monId;
+        i++;
+    }
+    return i == PICKS_PER_TRAINER;
+}
+
+static bool32 Pick(int method, struct Party *party, const u16 *monSet, bool32 lvl50)
+{
+    switch (method)
+    {
+    case METHOD_RESCAN:
+        return PickRescan(party, monSet, lvl50);
+    case METHOD_BITSET:
+        return PickWithExclusions(party, monSet, lvl50);
+    default:
+        return PickDirect(party, monSet, lvl50);
+    }
+}
+
+static void CheckNoRepeats(const u16 *monIds, int count, bool32 allowOneRepeatedSpecies, const char *name, unsigned id, u32 seed)
+{
+    int i, j;
+    int numRepeatedSpecies = 0;
+
+    for (i = 0; i < count; i++)
+    {
+        for (j = 0; j < i; j++)
+        {
+            if (GetSpecies(monIds[i]) == GetSpecies(monIds[j]))
+                numRepeatedSpecies++;
+            if (GetHeldItem(monIds[i]) != ITEM_NONE && GetHeldItem(monIds[i]) == GetHeldItem(monIds[j]))
+                FATAL_ERROR("%s: %u seed %u repeats held item %u\n", name, id, seed, GetHeldItem(monIds[i]));
+        }
+    }
+    if (numRepeatedSpecies > (allowOneRepeatedSpecies ? 1 : 0))
+        FATAL_ERROR("%s: %u seed %u repeats a species\n", name, id, seed);
+}
+
+static u32 GetSeed(unsigned id, u32 seed)
+{
+    return seed * 0x9E3779B9 + id;
+}
+
+#define NUM_TOWER_SCENARIOS 4
+
+// Picks a party for trainerId alone, or after a partner's party from the next
+// trainer, and adds the fastest of NUM_TIMING_RUNS to stats. Returns FALSE if
+// either set ran out.
+static bool32 RunTowerParty(int method, unsigned trainerId, int scenario, u32 seed, struct Party *party, struct Stats *stats)
+{
+    const u16 *monSet = gBattleFrontierTrainers[trainerId].monSet;
+    const u16 *partnerSet = gBattleFrontierTrainers[(trainerId + 1) % FRONTIER_TRAINERS_COUNT].monSet;
+    bool32 lvl50 = scenario & 1;
+    bool32 picked = TRUE;
+    double fastest = 0;
+    int run;
+
+    for (run = 0; run < NUM_TIMING_RUNS; run++)
+    {
+        double time;
+
+        party->count = 0;
+        sRngValue = GetSeed(trainerId, seed);
+        sRandomCalls = 0;
+        time = GetNanoseconds();
+        picked = !(scenario & 2) || Pick(method, party, partnerSet, lvl50);
+        if (picked)
+            picked = Pick(method, party, monSet, lvl50);
+        time = GetNanoseconds() - time;
+        if (run == 0 || time < fastest)
+            fastest = time;
+    }
+
+    if (picked && stats != NULL)
+        AddToStats(stats, sRandomCalls, fastest);
+    return picked;
+}
+
+static void BenchTower(void)
+{
+    static bool8 sRunsOut[FRONTIER_TRAINERS_COUNT][NUM_TOWER_SCENARIOS][TOWER_SEEDS];
+    struct Stats stats[METHOD_COUNT] = {0};
+    unsigned numRunsOut = 0;
+    unsigned trainerId;
+    int scenario, method;
+    u32 seed;
+
+    gFacilityTrainers = gBattleFrontierTrainers;
+    gFacilityTrainerMons = gBattleFrontierMons;
+
+    // The bitsets must not change which party a seed gives. Runs where a set
+    // runs out, which would hang the original game, are left out of the
+    // timings below.
+    for (trainerId = 0; trainerId < FRONTIER_TRAINERS_COUNT; trainerId++)
+    {
+        for (scenario = 0; scenario < NUM_TOWER_SCENARIOS; scenario++)
+        {
+            for (seed = 0; seed < TOWER_SEEDS; seed++)
+            {
+                struct Party party, rescanParty;
+                bool32 picked = RunTowerParty(METHOD_BITSET, trainerId, scenario, seed, &party, NULL);
+
+                if (RunTowerParty(METHOD_RESCAN, trainerId, scenario, seed, &rescanParty, NULL) != picked)
+                    FATAL_ERROR("bitset: trainer %u seed %u runs out differently than rescan\n", trainerId, seed);
+                if (picked && memcmp(rescanParty.monIds, party.monIds, sizeof(party.monIds[0]) * party.count) != 0)
+                    FATAL_ERROR("bitset: trainer %u seed %u picks a different party than rescan\n", trainerId, seed);
+                if (!picked)
+                    numRunsOut++;
+                sRunsOut[trainerId][scenario][seed] = !picked;
+            }
+        }
+    }
+
+    for (method = 0; method < METHOD_COUNT; method++)
+    {
+        for (trainerId = 0; trainerId < FRONTIER_TRAINERS_COUNT; trainerId++)
+        {
+            for (scenario = 0; scenario < NUM_TOWER_SCENARIOS; scenario++)
+            {
+                for (seed = 0; seed < TOWER_SEEDS; seed++)
+                {
+                    struct Party party;
+
+                    if (sRunsOut[trainerId][scenario][seed])
+                        continue;
+                    // Direct draws use the RNG differently, so they can
+                    // run out on a seed where the others don't.
+                    if (!RunTowerParty(method, trainerId, scenario, seed, &party, &stats[method]))
+                    {
+                        if (method != METHOD_DIRECT)
+                            FATAL_ERROR("%s: trainer %u seed %u runs out\n", sMethodNames[method], trainerId, seed);
+                        continue;
+                    }
+                    CheckNoRepeats(party.monIds, party.count, FALSE, sMethodNames[method], trainerId, seed);
+                }
+            }
+        }
+    }
+
+    printf("Tower: %u trainers, %d seeds each, level 50 and open level, alone and after a partner\n", FRONTIER_TRAINERS_COUNT, TOWER_SEEDS);
+    printf("  bitset picks the same parties as rescan\n");
+    if (numRunsOut != 0)
+        printf("  %u runs ran out of valid picks and are not timed (the original game hangs on them)\n", numRunsOut);
+    for (method = 0; method < METHOD_COUNT; method++)
+        PrintStats(sMethodNames[method], &stats[method]);
+}
+
+// The rental ranks GetNumPastRentalsRank gives for no rentals and for the most.
+static const u8 sFactoryRentsCounts[] = { 0, 43 };
+
+struct FactoryRun
+{
+    struct RentalMon rentalMons[ARRAY_COUNT(sSaveBlock2.frontier.rentalMons)];
+    u16 opponentMons[FRONTIER_PARTY_SIZE];
+    u32 rngValue;
+};
+
+static void SetFactoryChallenge(u8 lvlMode, u8 challengeNum, u8 rentsCount)
+{
+    memset(&sSaveBlock2, 0, sizeof(sSaveBlock2));
+    sSaveBlock2.frontier.lvlMode = lvlMode;
+    sSaveBlock2.frontier.factoryWinStreaks[FRONTIER_MODE_SINGLES][lvlMode] = challengeNum * FRONTIER_STAGES_PER_CHALLENGE;
+    sSaveBlock2.frontier.factoryRentsCount[FRONTIER_MODE_SINGLES][lvlMode] = rentsCount;
+}
+
+// Generates the rentals and then the opponent's party, as a Factory challenge
+// does, timing each step as in RunTowerParty.
+static void RunFactoryParty(bool32 orig, u32 seed, struct FactoryRun *result, struct Stats *rentalStats, struct Stats *opponentStats)
+{
+    struct SaveBlock2 start = sSaveBlock2;
+    double rentalFastest = 0, opponentFastest = 0;
+    unsigned rentalCalls = 0, opponentCalls = 0;
+    int run;
+
+    for (run = 0; run < NUM_TIMING_RUNS; run++)
+    {
+        double time;
+
+        sSaveBlock2 = start;
+        sRngValue = seed;
+        sRandomCalls = 0;
+        time = GetNanoseconds();
+        if (orig)
+            OrigGenerateInitialRentalMons();
+        else
+            NewGenerateInitialRentalMons();
+        time = GetNanoseconds() - time;
+        if (run == 0 || time < rentalFastest)
+            rentalFastest = time;
+        rentalCalls = sRandomCalls;
+
+        sRandomCalls = 0;
+        time = GetNanoseconds();
+        if (orig)
+            OrigGenerateOpponentMons();
+        else
+            NewGenerateOpponentMons();
+        time = GetNanoseconds() - time;
+        if (run == 0 || time < opponentFastest)
+            opponentFastest = time;
+        opponentCalls = sRandomCalls;
+    }
+
+    memcpy(result->rentalMons, sSaveBlock2.frontier.rentalMons, sizeof(result->rentalMons));
+    memcpy(result->opponentMons, gFrontierTempParty, sizeof(result->opponentMons));
+    result->rngValue = sRngValue;
+    sSaveBlock2 = start;
+    AddToStats(rentalStats, rentalCalls, rentalFastest);
+    AddToStats(opponentStats, opponentCalls, opponentFastest);
+}
+
+static void BenchFactory(void)
+{
+    struct Stats rentalStats[2] = {0};
+    struct Stats opponentStats[2] = {0};
+    u8 lvlMode, challengeNum;
+    unsigned rents, numChallenges = 0;
+    u32 seed;
+
+    for (lvlMode = FRONTIER_LVL_50; lvlMode <= FRONTIER_LVL_OPEN; lvlMode++)
+    {
+        for (challengeNum = 0; challengeNum <= 8; challengeNum++)
+        {
+            for (rents = 0; rents < ARRAY_COUNT(sFactoryRentsCounts); rents++)
+            {
+                unsigned id = (lvlMode * 9 + challengeNum) * ARRAY_COUNT(sFactoryRentsCounts) + rents;
+
+                SetFactoryChallenge(lvlMode, challengeNum, sFactoryRentsCounts[rents]);
+                numChallenges++;
+                for (seed = 0; seed < FACTORY_SEEDS; seed++)
+                {
+                    struct FactoryRun run, expected;
+                    u16 rentalMonIds[PARTY_SIZE];
+                    int i;
+
+                    RunFactoryParty(FALSE, GetSeed(id, seed), &run, &rentalStats[1], &opponentStats[1]);
+                    RunFactoryParty(TRUE, GetSeed(id, seed), &expected, &rentalStats[0], &opponentStats[0]);
+                    if (memcmp(run.rentalMons, expected.rentalMons, sizeof(run.rentalMons)) != 0)
+                        FATAL_ERROR("GenerateInitialRentalMons: challenge %u seed %u gives different rentals than the original\n", id, seed);
+                    if (memcmp(run.opponentMons, expected.opponentMons, sizeof(run.opponentMons)) != 0)
+                        FATAL_ERROR("GenerateOpponentMons: challenge %u seed %u gives a different party than the original\n", id, seed);
+                    if (run.rngValue != expected.rngValue)
+                        FATAL_ERROR("Factory: challenge %u seed %u leaves the RNG in a different state than the original\n", id, seed);
+
+                    for (i = 0; i < PARTY_SIZE; i++)
+                        rentalMonIds[i] = run.rentalMons[i].monId;
+                    CheckNoRepeats(rentalMonIds, PARTY_SIZE, TRUE, "rentals", id, seed);
+                    CheckNoRepeats(run.opponentMons, FRONTIER_PARTY_SIZE, FALSE, "opponent", id, seed);
+                    for (i = 0; i < FRONTIER_PARTY_SIZE; i++)
+                    {
+                        int j;
+
+                        for (j = 0; j < PARTY_SIZE; j++)
+                        {
+                            if (GetSpecies(run.opponentMons[i]) == GetSpecies(rentalMonIds[j]))
+                                FATAL_ERROR("opponent: challenge %u seed %u has a rental's species\n", id, seed);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    printf("Factory: %u challenges (level 50 and open level, challenges 0-8, lowest and highest rental rank), %d seeds each\n",
+           numChallenges, FACTORY_SEEDS);
+    printf("  the rentals and the opponent's party are the same as the original's\n");
+    PrintStats("rentals, original", &rentalStats[0]);
+    PrintStats("rentals, exclusions", &rentalStats[1]);
+    PrintStats("opponent, original", &opponentStats[0]);
+    PrintStats("opponent, exclusions", &opponentStats[1]);
+}
+
+int main(void)
+{
+    BenchTower();
+    BenchFactory();
+    return 0;
+}
@@ -0,0 +1,474 @@
+// statediff - finds where the game state of two logs starts to differ.
+//
+// Usage:
+//   statediff LOG_A LOG_B
+//       Compares the logs of two games, e.g. both sides of a link battle, a
+//       battle and its recording, or the same input replay on two builds.
+//       STATEHASH lines (STATE_HASH_LOG) are compared per field, and every
+//       field that differs at the first diverging event (battle turn) is
+//       named using the STATEFIELD lines from the logs.
+//       FRAMEHASH lines (FRAME_HASH_LOG) are compared frame by frame, and the
+//       first frame where the RNG, player, party, tasks or sprites differ is
+//       printed.
+//       Exits with 1 if the logs diverge, like it does on errors, and 0 if
+//       they don't. A log that is cut short, or has hash lines the other one
+//       doesn't, counts as diverging, so a truncated trace never passes.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#define FATAL_ERROR(format, ...)            \
+do                                          \
+{                                           \
+    fprintf(stderr, format, ##__VA_ARGS__); \
+    exit(1);                                \
+} while (0)
+
+#define MAX_LINE_LENGTH 1024
+#define MAX_NAME_LENGTH 64
+#define FIELDS_PER_LINE 8 // Must match state_hash.c
+
+struct Field
+{
+    char name[MAX_NAME_LENGTH];
+    unsigned offset;
+    unsigned size;
+};
+
+struct Block
+{
+    char name[MAX_NAME_LENGTH];
+    struct Field *fields;
+    int fieldCount;
+    unsigned maxElement;
+};
+
+struct Record
+{
+    char event[MAX_NAME_LENGTH];
+    unsigned id;
+    char block[MAX_NAME_LENGTH];
+    unsigned element;
+    unsigned firstField;
+    unsigned hashes[FIELDS_PER_LINE];
+    int occurrence; // How many identical keys come before this one in the log
+};
+
+enum
+{
+    FRAME_RNG,
+    FRAME_PLAYER,
+    FRAME_PARTY,
+    FRAME_TASKS,
+    FRAME_SPRITES,
+    FRAME_PART_COUNT
+};
+
+static const char *const sFramePartNames[FRAME_PART_COUNT] =
+{
+    [FRAME_RNG]     = "rng",
+    [FRAME_PLAYER]  = "player",
+    [FRAME_PARTY]   = "party",
+    [FRAME_TASKS]   = "tasks",
+    [FRAME_SPRITES] = "sprites",
+};
+
+struct Frame
+{
+    unsigned frame;
+    unsigned keys;
+    unsigned hashes[FRAME_PART_COUNT];
+};
+
+struct Log
+{
+    const char *path;
+    struct Record *records;
+    int count;
+    int capacity;
+    struct Frame *frames;
+    int frameCount;
+    int frameCapacity;
+};
+
+static struct Block *sBlocks;
+static int sBlockCount;
+
+static struct Block *GetBlock(const char *name)
+{
+    int i;
+
+    for (i = 0; i < sBlockCount; i++)
+        if (strcmp(sBlocks[i].name, name) == 0)
+            return &sBlocks[i];
+
+    sBlocks = realloc(sBlocks, (sBlockCount + 1) * sizeof(*sBlocks));
+    if (sBlocks == NULL)
+        FATAL_ERROR("Out of memory\n");
+
+    memset(&sBlocks[sBlockCount], 0, sizeof(*sBlocks));
+    snprintf(sBlocks[sBlockCount].name, MAX_NAME_LENGTH, "%s", name);
+    return &sBlocks[sBlockCount++];
+}
+
+static void AddField(const char *blockName, int index, unsigned offset, unsigned size, const char *name)
+{
+    struct Block *block = GetBlock(blockName);
+
+    if (index < block->fieldCount)
+    {
+        if (strcmp(block->fields[index].name, name) != 0 || block->fields[index].offset != offset)
+            fprintf(stderr, "warning: the logs disagree on the layout of %s.%s\n", blockName, name);
+        return;
+    }
+
+    if (index != block->fieldCount)
+        FATAL_ERROR("STATEFIELD lines for %s are out of order\n", blockName);
+
+    block->fields = realloc(block->fields, (block->fieldCount + 1) * sizeof(*block->fields));
+    if (block->fields == NULL)
+        FATAL_ERROR("Out of memory\n");
+
+    snprintf(block->fields[index].name, MAX_NAME_LENGTH, "%s", name);
+    block->fields[index].offset = offset;
+    block->fields[index].size = size;
+    block->fieldCount++;
+}
+
+static bool IsSameKey(const struct Record *a, const struct Record *b)
+{
+    return a->id == b->id
+        && a->element == b->element
+        && a->firstField == b->firstField
+        && strcmp(a->event, b->event) == 0
+        && strcmp(a->block, b->block) == 0;
+}
+
+static void AddRecord(struct Log *log, const struct Record *record)
+{
+    int i;
+
+    if (log->count == log->capacity)
+    {
+        log->capacity = log->capacity ? log->capacity * 2 : 256;
+        log->records = realloc(log->records, log->capacity * sizeof(*log->records));
+        if (log->records == NULL)
+            FATAL_ERROR("Out of memory\n");
+    }
+
+    log->records[log->count] = *record;
+    log->records[log->count].occurrence = 0;
+
+    // The same turn number comes up again in every battle.
+    for (i = log->count - 1; i >= 0; i--)
+    {
+        if (IsSameKey(&log->records[i], record))
+        {
+            log->records[log->count].occurrence = log->records[i].occurrence + 1;
+            break;
+        }
+    }
+
+    log->count++;
+}
+
+static void AddFrame(struct Log *log, const struct Frame *frame)
+{
+    if (log->frameCount == log->frameCapacity)
+    {
+        log->frameCapacity = log->frameCapacity ? log->frameCapacity * 2 : 1024;
+        log->frames = realloc(log->frames, log->frameCapacity * sizeof(*log->frames));
+        if (log->frames == NULL)
+            FATAL_ERROR("Out of memory\n");
+    }
+
+    log->frames[log->frameCount++] = *frame;
+}
+
+static void ReadLog(struct Log *log, const char *path)
+{
+    char line[MAX_LINE_LENGTH];
+    FILE *fp = fopen(path, "r");
+
+    if (fp == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for reading\n", path);
+
+    memset(log, 0, sizeof(*log));
+    log->path = path;
+
+    while (fgets(line, sizeof(line), fp))
+    {
+        char *p;
+
+        // Emulators put their own prefix in front of debug prints.
+        if ((p = strstr(line, "STATEFIELD ")) != NULL)
+        {
+            char block[MAX_NAME_LENGTH];
+            char name[MAX_NAME_LENGTH];
+            int index;
+            unsigned offset, size;
+
+            if (sscanf(p, "STATEFIELD %63s %d %u %u %63s", block, &index, &offset, &size, name) == 5)
+                AddField(block, index, offset, size, name);
+        }
+        else if ((p = strstr(line, "STATEHASH ")) != NULL)
+        {
+            struct Record record;
+            unsigned *h = record.hashes;
+
+            if (sscanf(p, "STATEHASH %63s %u %63s %u %u %x %x %x %x %x %x %x %x",
+                       record.event, &record.id, record.block, &record.element, &record.firstField,
+                       &h[0], &h[1], &h[2], &h[3], &h[4], &h[5], &h[6], &h[7]) == 13)
+            {
+                struct Block *block = GetBlock(record.block);
+
+                if (record.element > block->maxElement)
+                    block->maxElement = record.element;
+                AddRecord(log, &record);
+            }
+        }
+        else if ((p = strstr(line, "FRAMEHASH ")) != NULL)
+        {
+            struct Frame frame;
+            unsigned *h = frame.hashes;
+
+            if (sscanf(p, "FRAMEHASH %u %x %x %x %x %x %x",
+                       &frame.frame, &frame.keys, &h[0], &h[1], &h[2], &h[3], &h[4]) == 7)
+                AddFrame(log, &frame);
+        }
+    }
+
+    fclose(fp);
+
+    if (log->count == 0 && log->frameCount == 0)
+        FATAL_ERROR("\"%s\" has no STATEHASH or FRAMEHASH lines. Was it made by a build with STATE_HASH_LOG or FRAME_HASH_LOG defined?\n", path);
+}
+
+static const struct Record *FindRecord(const struct Log *log, const struct Record *key)
+{
+    int i;
+
+    for (i = 0; i < log->count; i++)
+        if (IsSameKey(&log->records[i], key) && log->records[i].occurrence == key->occurrence)
+            return &log->records[i];
+
+    return NULL;
+}
+
+static bool IsSameEvent(const struct Record *a, const struct Record *b)
+{
+    return a->id == b->id && a->occurrence == b->occurrence && strcmp(a->event, b->event) == 0;
+}
+
+static void PrintField(const struct Record *record, unsigned field)
+{
+    struct Block *block = GetBlock(record->block);
+
+    printf("  %s", block->name);
+    if (block->maxElement != 0)
+        printf("[%u]", record->element);
+
+    if (field < (unsigned)block->fieldCount)
+        printf(".%s (offset 0x%X, %u bytes)\n", block->fields[field].name,
+               block->fields[field].offset, block->fields[field].size);
+    else
+        printf(" field %u\n", field);
+}
+
+// Returns the number of differing fields in a record.
+static int CompareRecord(const struct Record *a, const struct Record *b, bool print)
+{
+    struct Block *block = GetBlock(a->block);
+    int count = 0;
+    int i;
+
+    for (i = 0; i < FIELDS_PER_LINE; i++)
+    {
+        unsigned field = a->firstField + i;
+
+        // Unused slots at the end of a line are printed as 0 on both sides.
+        if (block->fieldCount != 0 && field >= (unsigned)block->fieldCount)
+            break;
+
+        if (a->hashes[i] != b->hashes[i])
+        {
+            if (print)
+                PrintField(a, field);
+            count++;
+        }
+    }
+
+    return count;
+}
+
+// Returns the number of hash lines in a that have no match in b.
+static int CountUnmatchedRecords(const struct Log *a, const struct Log *b)
+{
+    int missing = 0;
+    int i;
+
+    for (i = 0; i < a->count; i++)
+        if (FindRecord(b, &a->records[i]) == NULL)
+            missing++;
+
+    return missing;
+}
+
+// Returns whether any hash line differs or is only in one of the logs.
+static bool DiffLogs(const struct Log *a, const struct Log *b)
+{
+    const struct Record *firstEvent = NULL;
+    int laterLines = 0;
+    int missing = 0;
+    int missingFromA;
+    int i;
+
+    for (i = 0; i < a->count; i++)
+    {
+        const struct Record *recordA = &a->records[i];
+        const struct Record *recordB = FindRecord(b, recordA);
+
+        if (recordB == NULL)
+        {
+            missing++;
+            continue;
+        }
+
+        if (firstEvent != NULL && IsSameEvent(firstEvent, recordA))
+        {
+            CompareRecord(recordA, recordB, true);
+        }
+        else if (CompareRecord(recordA, recordB, false) != 0)
+        {
+            if (firstEvent == NULL)
+            {
+                firstEvent = recordA;
+                printf("First difference at %s %u", recordA->event, recordA->id);
+                if (recordA->occurrence != 0)
+                    printf(" (occurrence %d)", recordA->occurrence + 1);
+                printf(":\n");
+                CompareRecord(recordA, recordB, true);
+            }
+            else
+            {
+                laterLines++;
+            }
+        }
+    }
+
+    if (firstEvent == NULL)
+        printf("No differences in the %d hash lines both logs have.\n", a->count - missing);
+    else if (laterLines != 0)
+        printf("%d later hash lines also differ.\n", laterLines);
+
+    if (missing != 0)
+        printf("%d hash lines in %s have no match in %s.\n", missing, a->path, b->path);
+
+    missingFromA = CountUnmatchedRecords(b, a);
+    if (missingFromA != 0)
+        printf("%d hash lines in %s have no match in %s.\n", missingFromA, b->path, a->path);
+
+    return firstEvent != NULL || missing != 0 || missingFromA != 0;
+}
+
+// Returns whether any frame differs, or the logs don't have the same frames.
+static bool DiffFrames(const struct Log *a, const struct Log *b)
+{
+    int count = a->frameCount < b->frameCount ? a->frameCount : b->frameCount;
+    int keysDiffer = -1;
+    int i, j;
+
+    for (i = 0; i < count; i++)
+    {
+        const struct Frame *frameA = &a->frames[i];
+        const struct Frame *frameB = &b->frames[i];
+        bool differs = false;
+
+        // A frame number that doesn't line up means a line is missing.
+        if (frameA->frame != frameB->frame)
+        {
+            printf("Frame %u in %s is frame %u in %s, so one of the logs is missing lines.\n",
+                   frameA->frame, a->path, frameB->frame, b->path);
+            return true;
+        }
+
+        if (keysDiffer < 0 && frameA->keys != frameB->keys)
+            keysDiffer = i;
+
+        for (j = 0; j < FRAME_PART_COUNT; j++)
+            if (frameA->hashes[j] != frameB->hashes[j])
+                differs = true;
+
+        if (!differs)
+            continue;
+
+        printf("First divergent frame: %u, differs in", frameA->frame);
+        for (j = 0; j < FRAME_PART_COUNT; j++)
+            if (frameA->hashes[j] != frameB->hashes[j])
+                printf(" %s", sFramePartNames[j]);
+        printf("\n");
+
+        // The hashes are taken after a frame's input has been handled, so
+        // input that differs on the same frame can explain the divergence.
+        if (keysDiffer >= 0)
+            printf("The held keys already differ at frame %u, so the replays are out of sync.\n",
+                   a->frames[keysDiffer].frame);
+        return true;
+    }
+
+    printf("No divergence in the %d frames both logs have.\n", count);
+
+    if (a->frameCount != b->frameCount)
+    {
+        const struct Log *shorter = a->frameCount < b->frameCount ? a : b;
+        const struct Log *longer = shorter == a ? b : a;
+
+        printf("%s stops at frame %u, but %s goes on for %d more frames.\n",
+               shorter->path, shorter->frames[count - 1].frame, longer->path, longer->frameCount - count);
+        return true;
+    }
+
+    return false;
+}
+
+int main(int argc, char **argv)
+{
+    struct Log a, b;
+    bool diverged = false;
+
+    if (argc != 3)
+        FATAL_ERROR("Usage: statediff LOG_A LOG_B\n");
+
+    ReadLog(&a, argv[1]);
+    ReadLog(&b, argv[2]);
+
+    if (a.count != 0 || b.count != 0)
+    {
+        if (a.count == 0 || b.count == 0)
+        {
+            printf("Only %s has STATEHASH lines.\n", a.count != 0 ? a.path : b.path);
+            diverged = true;
+        }
+        else if (DiffLogs(&a, &b))
+        {
+            diverged = true;
+        }
+    }
+
+    if (a.frameCount != 0 || b.frameCount != 0)
+    {
+        if (a.frameCount == 0 || b.frameCount == 0)
+        {
+            printf("Only %s has FRAMEHASH lines.\n", a.frameCount != 0 ? a.path : b.path);
+            diverged = true;
+        }
+        else if (DiffFrames(&a, &b))
+        {
+            diverged = true;
+        }
+    }
+
+    return diverged ? 1 : 0;
+}
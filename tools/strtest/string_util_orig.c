@@ -0,0 +1,140 @@
+// The string functions src/string_util.c used to do a byte at a time, as
+// they were before they moved to word-at-a-time scanning, renamed with an
+// Orig prefix. They are kept as the reference strtest checks the current code
+// against, so don't change them to match src/string_util.c.
+//
+// The functions that didn't change (StringCopyN, GetExpandedPlaceholder) are
+// the ones from src/string_util.c.
+
+#include "global.h"
+#include "string_util.h"
+#include "text.h"
+#include "string_util_orig.h"
+
+u8 *OrigStringCopy(u8 *dest, const u8 *src)
+{
+    while (*src != EOS)
+    {
+        *dest = *src;
+        dest++;
+        src++;
+    }
+
+    *dest = EOS;
+    return dest;
+}
+
+u8 *OrigStringAppend(u8 *dest, const u8 *src)
+{
+    while (*dest != EOS)
+        dest++;
+
+    return OrigStringCopy(dest, src);
+}
+
+u8 *OrigStringAppendN(u8 *dest, const u8 *src, u8 n)
+{
+    while (*dest != EOS)
+        dest++;
+
+    return StringCopyN(dest, src, n);
+}
+
+u16 OrigStringLength(const u8 *str)
+{
+    u16 length = 0;
+
+    while (str[length] != EOS)
+        length++;
+
+    return length;
+}
+
+s32 OrigStringCompare(const u8 *str1, const u8 *str2)
+{
+    while (*str1 == *str2)
+    {
+        if (*str1 == EOS)
+            return 0;
+        str1++;
+        str2++;
+    }
+
+    return *str1 - *str2;
+}
+
+s32 OrigStringCompareN(const u8 *str1, const u8 *str2, u32 n)
+{
+    while (*str1 == *str2)
+    {
+        if (*str1 == EOS)
+            return 0;
+        str1++;
+        str2++;
+        if (--n == 0)
+            return 0;
+    }
+
+    return *str1 - *str2;
+}
+
+u8 *OrigStringExpandPlaceholders(u8 *dest, const u8 *src)
+{
+    for (;;)
+    {
+        u8 c = *src++;
+        u8 placeholderId;
+        const u8 *expandedString;
+
+        switch (c)
+        {
+        case PLACEHOLDER_BEGIN:
+            placeholderId = *src++;
+            expandedString = GetExpandedPlaceholder(placeholderId);
+            dest = OrigStringExpandPlaceholders(dest, expandedString);
+            break;
+        case EXT_CTRL_CODE_BEGIN:
+            *dest++ = c;
+            c = *src++;
+            *dest++ = c;
+
+            switch (c)
+            {
+            case EXT_CTRL_CODE_RESET_FONT:
+            case EXT_CTRL_CODE_PAUSE_UNTIL_PRESS:
+            case EXT_CTRL_CODE_FILL_WINDOW:
+            case EXT_CTRL_CODE_JPN:
+            case EXT_CTRL_CODE_ENG:
+            case EXT_CTRL_CODE_PAUSE_MUSIC:
+            case EXT_CTRL_CODE_RESUME_MUSIC:
+                break;
+            case EXT_CTRL_CODE_COLOR_HIGHLIGHT_SHADOW:
+                *dest++ = *src++;
+            case EXT_CTRL_CODE_PLAY_BGM:
+                *dest++ = *src++;
+            default:
+                *dest++ = *src++;
+            }
+            break;
+        case EOS:
+            *dest = EOS;
+            return dest;
+        case CHAR_PROMPT_SCROLL:
+        case CHAR_PROMPT_CLEAR:
+        case CHAR_NEWLINE:
+        default:
+            *dest++ = c;
+        }
+    }
+}
+
+u8 *OrigStringFill(u8 *dest, u8 c, u16 n)
+{
+    u16 i;
+
+    for (i = 0; i < n; i++)
+        *dest++ = c;
+
+    *dest = EOS;
+    return dest;
+}
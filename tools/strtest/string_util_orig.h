@@ -0,0 +1,13 @@
+#ifndef GUARD_STRING_UTIL_ORIG_H
+#define GUARD_STRING_UTIL_ORIG_H
+
+u8 *OrigStringCopy(u8 *dest, const u8 *src);
+u8 *OrigStringAppend(u8 *dest, const u8 *src);
+u8 *OrigStringAppendN(u8 *dest, const u8 *src, u8 n);
+u16 OrigStringLength(const u8 *str);
+s32 OrigStringCompare(const u8 *str1, const u8 *str2);
+s32 OrigStringCompareN(const u8 *str1, const u8 *str2, u32 n);
+u8 *OrigStringExpandPlaceholders(u8 *dest, const u8 *src);
+u8 *OrigStringFill(u8 *dest, u8 c, u16 n);
+
+#endif // GUARD_STRING_UTIL_ORIG_H
@@ -0,0 +1,479 @@
+// strtest - checks the string functions in src/string_util.c against the
+// byte-at-a-time versions they replaced (string_util_orig.c).
+//
+// Usage:
+//   strtest
+//       Exits with 1 after printing the first mismatch, if any.
+//
+// Every check runs with the strings and destinations at each of 8 offsets
+// from a word boundary, so every source/destination alignment pair is
+// covered, and with every string length up to past several words, so EOS
+// lands in each byte lane. Destinations start out filled with the same
+// garbage, and the whole buffer must match afterwards, not just the string.
+//   - StringLength, StringCopy and StringAppend on random text.
+//   - StringAppendN and StringCompareN with n from 0 to 8, around each word
+//     multiple, and at the largest values their types allow.
+//   - StringCompare(N) on strings that differ at each position, by bytes
+//     above and below the original, and that differ only after EOS.
+//   - StringExpandPlaceholders on random mixes of plain text, prompt and
+//     newline characters (0xFA, 0xFB, 0xFE), ext ctrl codes with their
+//     arguments and placeholders, including ones that expand to strings
+//     with their own ctrl codes and placeholders.
+//   - StringFill with every fill byte.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "global.h"
+#include "string_util.h"
+#include "strings.h"
+#include "text.h"
+#include "string_util_orig.h"
+
+#define FATAL_ERROR(format, ...)            \
+do                                          \
+{                                           \
+    fprintf(stderr, format, ##__VA_ARGS__); \
+    exit(1);                                \
+} while (0)
+
+#define NUM_OFFSETS 8
+#define MAX_LENGTH 72
+#define MAX_DEST_LENGTH 12
+#define NUM_RANDOM_STRINGS 16
+#define NUM_EXPAND_STRINGS 4000
+#define STRING_BUFFER_SIZE 1024
+#define DEST_BUFFER_SIZE 2048
+
+// Plain text, as far as StringExpandPlaceholders is concerned.
+#define MAX_PLAIN_CHAR (EXT_CTRL_CODE_BEGIN - 1)
+
+static struct SaveBlock2 sSaveBlock2;
+struct SaveBlock2 *gSaveBlock2Ptr = &sSaveBlock2;
+
+// Stand-ins for the game's placeholder strings, of different lengths so the
+// text after them lands at different alignments.
+const u8 gText_ExpandedPlaceholder_Empty[] = { EOS };
+const u8 gText_ExpandedPlaceholder_Kun[] = { 0xD5, 0xE9, EOS };
+const u8 gText_ExpandedPlaceholder_Chan[] = { 0xBD, 0xE2, 0xD5, 0xE2, EOS };
+const u8 gText_ExpandedPlaceholder_Sapphire[] = { EOS };
+const u8 gText_ExpandedPlaceholder_Ruby[] = { EOS };
+const u8 gText_ExpandedPlaceholder_Emerald[] = { 0xBF, 0xE1, 0xD9, 0xE6, 0xD5, 0xE0, 0xD8, EOS };
+const u8 gText_ExpandedPlaceholder_Aqua[] = { EXT_CTRL_CODE_BEGIN, EXT_CTRL_CODE_COLOR, 2, 0xBB, 0xE5, 0xE9, 0xD5, EOS };
+const u8 gText_ExpandedPlaceholder_Magma[] = { 0xC7, 0xD5, PLACEHOLDER_BEGIN, PLACEHOLDER_ID_KYOGRE, 0xDB, 0xE1, 0xD5, EOS };
+const u8 gText_ExpandedPlaceholder_Archie[] = { 0xBB, 0xE6, 0xD7, 0xDC, 0xDD, 0xD9, CHAR_NEWLINE, EOS };
+const u8 gText_ExpandedPlaceholder_Maxie[] = { 0xC7, 0xD5, 0xEC, 0xDD, 0xD9, EOS };
+const u8 gText_ExpandedPlaceholder_Kyogre[] = { 0xC5, 0xED, 0xE3, 0xDB, 0xE6, 0xD9, EOS };
+const u8 gText_ExpandedPlaceholder_Groudon[] = { 0xC1, 0xE6, 0xE3, 0xE9, 0xD8, 0xE3, 0xE2, EXT_CTRL_CODE_BEGIN, EXT_CTRL_CODE_RESET_FONT, EOS };
+const u8 gText_ExpandedPlaceholder_Brendan[] = { 0xBC, 0xE6, 0xD9, 0xE2, 0xD8, 0xD5, 0xE2, EOS };
+const u8 gText_ExpandedPlaceholder_May[] = { 0xC7, 0xD5, 0xED, EOS };
+
+static u8 ALIGNED(8) sString1[STRING_BUFFER_SIZE];
+static u8 ALIGNED(8) sString2[STRING_BUFFER_SIZE];
+static u8 ALIGNED(8) sOrigDest[DEST_BUFFER_SIZE];
+static u8 ALIGNED(8) sNewDest[DEST_BUFFER_SIZE];
+
+static unsigned long sNumChecks;
+
+static u32 sRngState = 0x12345678;
+
+static u32 NextRandom(void)
+{
+    sRngState ^= sRngState << 13;
+    sRngState ^= sRngState >> 17;
+    sRngState ^= sRngState << 5;
+    return sRngState;
+}
+
+static void FillRandom(u8 *buffer, int length, u8 maxByte)
+{
+    int i;
+
+    for (i = 0; i < length; i++)
+        buffer[i] = NextRandom() % (maxByte + 1);
+}
+
+// Writes a random string of length non-EOS bytes at str, followed by random
+// bytes that may or may not be EOS.
+static void MakeString(u8 *str, int length)
+{
+    FillRandom(str, length, EOS - 1);
+    str[length] = EOS;
+    FillRandom(str + length + 1, 8, EOS);
+}
+
+static void FillDests(void)
+{
+    FillRandom(sOrigDest, DEST_BUFFER_SIZE, EOS);
+    memcpy(sNewDest, sOrigDest, DEST_BUFFER_SIZE);
+}
+
+static void CompareDests(const u8 *origEnd, const u8 *newEnd, const char *func, int offset1, int offset2, int length)
+{
+    int i;
+
+    sNumChecks++;
+    if (origEnd - sOrigDest == newEnd - sNewDest && memcmp(sOrigDest, sNewDest, DEST_BUFFER_SIZE) == 0)
+        return;
+    if (origEnd - sOrigDest != newEnd - sNewDest)
+    {
+        FATAL_ERROR("%s, offsets %d/%d, length %d: returns dest + %d, expected dest + %d\n",
+                    func, offset1, offset2, length, (int)(newEnd - sNewDest), (int)(origEnd - sOrigDest));
+    }
+    for (i = 0; i < DEST_BUFFER_SIZE; i++)
+    {
+        if (sOrigDest[i] != sNewDest[i])
+        {
+            FATAL_ERROR("%s, offsets %d/%d, length %d: byte %d is 0x%02X, expected 0x%02X\n",
+                        func, offset1, offset2, length, i, sNewDest[i], sOrigDest[i]);
+        }
+    }
+}
+
+static void CheckResult(s32 origResult, s32 newResult, const char *func, int offset1, int offset2, int length, u32 n)
+{
+    sNumChecks++;
+    if (origResult != newResult)
+    {
+        FATAL_ERROR("%s, offsets %d/%d, length %d, n %u: returns %d, expected %d\n",
+                    func, offset1, offset2, length, n, newResult, origResult);
+    }
+}
+
+static void CheckLengthAndCopy(void)
+{
+    int length, srcOffset, destOffset, i;
+
+    for (length = 0; length <= MAX_LENGTH; length++)
+    {
+        for (i = 0; i < NUM_RANDOM_STRINGS; i++)
+        {
+            for (srcOffset = 0; srcOffset < NUM_OFFSETS; srcOffset++)
+            {
+                const u8 *src = sString1 + srcOffset;
+
+                MakeString(sString1 + srcOffset, length);
+                CheckResult(OrigStringLength(src), StringLength(src), "StringLength", srcOffset, 0, length, 0);
+
+                for (destOffset = 0; destOffset < NUM_OFFSETS; destOffset++)
+                {
+                    FillDests();
+                    CompareDests(OrigStringCopy(sOrigDest + destOffset, src),
+                                 StringCopy(sNewDest + destOffset, src),
+                                 "StringCopy", srcOffset, destOffset, length);
+                }
+            }
+        }
+    }
+    printf("StringLength, StringCopy: OK\n");
+}
+
+static const u32 *GetNs(int *count)
+{
+    static u32 sNs[64];
+    static int sCount;
+
+    if (sCount == 0)
+    {
+        u32 n;
+
+        for (n = 0; n <= 8; n++)
+            sNs[sCount++] = n;
+        for (n = 12; n <= MAX_LENGTH + 8; n += 4)
+        {
+            sNs[sCount++] = n - 1;
+            sNs[sCount++] = n;
+            sNs[sCount++] = n + 1;
+        }
+        sNs[sCount++] = 0xFF;
+    }
+    *count = sCount;
+    return sNs;
+}
+
+static void CheckAppend(void)
+{
+    int length, destLength, srcOffset, destOffset, i, j, numNs;
+    const u32 *ns = GetNs(&numNs);
+
+    for (length = 0; length <= MAX_LENGTH; length++)
+    {
+        for (destLength = 0; destLength <= MAX_DEST_LENGTH; destLength++)
+        {
+            for (srcOffset = 0; srcOffset < NUM_OFFSETS; srcOffset++)
+            {
+                const u8 *src = sString1 + srcOffset;
+
+                MakeString(sString1 + srcOffset, length);
+                for (destOffset = 0; destOffset < NUM_OFFSETS; destOffset++)
+                {
+                    FillDests();
+                    MakeString(sOrigDest + destOffset, destLength);
+                    memcpy(sNewDest, sOrigDest, DEST_BUFFER_SIZE);
+                    CompareDests(OrigStringAppend(sOrigDest + destOffset, src),
+                                 StringAppend(sNewDest + destOffset, src),
+                                 "StringAppend", srcOffset, destOffset, length);
+
+                    // StringCopyN didn't change, so only a few n are needed
+                    // to check that StringAppendN finds the same end.
+                    for (i = 0; i < 4; i++)
+                    {
+                        u8 n = ns[(srcOffset * NUM_OFFSETS + destOffset + i * 7) % numNs];
+
+                        FillDests();
+                        MakeString(sOrigDest + destOffset, destLength);
+                        memcpy(sNewDest, sOrigDest, DEST_BUFFER_SIZE);
+                        CompareDests(OrigStringAppendN(sOrigDest + destOffset, src, n),
+                                     StringAppendN(sNewDest + destOffset, src, n),
+                                     "StringAppendN", srcOffset, destOffset, length);
+                    }
+                }
+            }
+        }
+    }
+
+    // And every n, for every alignment.
+    for (srcOffset = 0; srcOffset < NUM_OFFSETS; srcOffset++)
+    {
+        for (destOffset = 0; destOffset < NUM_OFFSETS; destOffset++)
+        {
+            for (j = 0; j < numNs; j++)
+            {
+                MakeString(sString1 + srcOffset, NextRandom() % (MAX_LENGTH + 1));
+                FillDests();
+                MakeString(sOrigDest + destOffset, NextRandom() % (MAX_DEST_LENGTH + 1));
+                memcpy(sNewDest, sOrigDest, DEST_BUFFER_SIZE);
+                CompareDests(OrigStringAppendN(sOrigDest + destOffset, sString1 + srcOffset, ns[j]),
+                             StringAppendN(sNewDest + destOffset, sString1 + srcOffset, ns[j]),
+                             "StringAppendN", srcOffset, destOffset, ns[j]);
+            }
+        }
+    }
+    printf("StringAppend, StringAppendN: OK\n");
+}
+
+// Makes the string at str2 a copy of the one at str1, changed at diffPos.
+// A diffPos past the length changes a byte after EOS, which mustn't matter.
+static void MakeComparedStrings(u8 *str1, u8 *str2, int length, int diffPos)
+{
+    MakeString(str1, length);
+    memcpy(str2, str1, length + 1);
+    FillRandom(str2 + length + 1, 8, EOS);
+
+    if (diffPos <= length)
+    {
+        u8 c = str1[diffPos];
+
+        // Bytes above and below, including EOS itself and 0x00.
+        switch (NextRandom() % 4)
+        {
+        case 0:
+            str2[diffPos] = EOS;
+            break;
+        case 1:
+            str2[diffPos] = 0;
+            break;
+        default:
+            do
+            {
+                str2[diffPos] = NextRandom() % (EOS + 1);
+            } while (str2[diffPos] == c);
+            break;
+        }
+        if (str2[diffPos] == c)
+            str2[diffPos] ^= 1;
+        if (diffPos == length)
+        {
+            // str2 is the longer string now.
+            str2[length + 1] = NextRandom() % 2 ? EOS : 0x01;
+            str2[length + 2] = EOS;
+        }
+    }
+}
+
+static void CheckCompare(void)
+{
+    int length, diffPos, offset1, offset2, j, numNs;
+    const u32 *ns = GetNs(&numNs);
+
+    for (length = 0; length <= MAX_LENGTH; length++)
+    {
+        for (diffPos = 0; diffPos <= length + 1; diffPos++)
+        {
+            for (offset1 = 0; offset1 < NUM_OFFSETS; offset1++)
+            {
+                for (offset2 = 0; offset2 < NUM_OFFSETS; offset2++)
+                {
+                    const u8 *str1 = sString1 + offset1;
+                    const u8 *str2 = sString2 + offset2;
+
+                    MakeComparedStrings(sString1 + offset1, sString2 + offset2, length, diffPos);
+                    CheckResult(OrigStringCompare(str1, str2), StringCompare(str1, str2), "StringCompare", offset1, offset2, length, 0);
+                    CheckResult(OrigStringCompare(str2, str1), StringCompare(str2, str1), "StringCompare", offset2, offset1, length, 0);
+
+                    for (j = 0; j < numNs; j++)
+                    {
+                        CheckResult(OrigStringCompareN(str1, str2, ns[j]), StringCompareN(str1, str2, ns[j]), "StringCompareN", offset1, offset2, length, ns[j]);
+                        CheckResult(OrigStringCompareN(str2, str1, ns[j]), StringCompareN(str2, str1, ns[j]), "StringCompareN", offset2, offset1, length, ns[j]);
+                    }
+                    CheckResult(OrigStringCompareN(str1, str2, diffPos), StringCompareN(str1, str2, diffPos), "StringCompareN", offset1, offset2, length, diffPos);
+                    CheckResult(OrigStringCompareN(str1, str2, diffPos + 1), StringCompareN(str1, str2, diffPos + 1), "StringCompareN", offset1, offset2, length, diffPos + 1);
+                    CheckResult(OrigStringCompareN(str1, str2, 0xFFFFFFFF), StringCompareN(str1, str2, 0xFFFFFFFF), "StringCompareN", offset1, offset2, length, 0xFFFFFFFF);
+                }
+            }
+        }
+    }
+    printf("StringCompare, StringCompareN: OK\n");
+}
+
+// How many argument bytes StringExpandPlaceholders copies after an ext ctrl
+// code.
+static int GetExpandedCtrlCodeArgCount(u8 code)
+{
+    switch (code)
+    {
+    case EXT_CTRL_CODE_RESET_FONT:
+    case EXT_CTRL_CODE_PAUSE_UNTIL_PRESS:
+    case EXT_CTRL_CODE_FILL_WINDOW:
+    case EXT_CTRL_CODE_JPN:
+    case EXT_CTRL_CODE_ENG:
+    case EXT_CTRL_CODE_PAUSE_MUSIC:
+    case EXT_CTRL_CODE_RESUME_MUSIC:
+        return 0;
+    case EXT_CTRL_CODE_COLOR_HIGHLIGHT_SHADOW:
+        return 3;
+    case EXT_CTRL_CODE_PLAY_BGM:
+        return 2;
+    default:
+        return 1;
+    }
+}
+
+// Writes random text of about length bytes, which can run up to 4 bytes
+// over to finish an ext ctrl code, with at most maxPlaceholders
+// placeholders. With varPlaceholders, those can be the string variables
+// and player name, which are themselves made with it FALSE. The unknown
+// string variable placeholder is left out, since nothing ever sets it.
+static void MakeText(u8 *str, int length, int maxPlaceholders, bool32 varPlaceholders)
+{
+    int pos = 0;
+
+    while (pos < length)
+    {
+        int i, count;
+
+        switch (NextRandom() % 16)
+        {
+        case 0 ... 7:
+            str[pos++] = NextRandom() % (MAX_PLAIN_CHAR + 1);
+            break;
+        case 8:
+            switch (NextRandom() % 3)
+            {
+            case 0:
+                str[pos++] = CHAR_PROMPT_SCROLL;
+                break;
+            case 1:
+                str[pos++] = CHAR_PROMPT_CLEAR;
+                break;
+            default:
+                str[pos++] = CHAR_NEWLINE;
+                break;
+            }
+            break;
+        case 9 ... 10:
+            if (maxPlaceholders == 0)
+                break;
+            maxPlaceholders--;
+            str[pos++] = PLACEHOLDER_BEGIN;
+            if (!varPlaceholders)
+                str[pos++] = PLACEHOLDER_ID_KUN + NextRandom() % (PLACEHOLDER_ID_GROUDON - PLACEHOLDER_ID_KUN + 1);
+            else if (NextRandom() % 8 == 0)
+                str[pos++] = PLACEHOLDER_ID_GROUDON + 1 + NextRandom() % (EOS - PLACEHOLDER_ID_GROUDON); // Out of range
+            else
+                str[pos++] = PLACEHOLDER_ID_PLAYER + NextRandom() % PLACEHOLDER_ID_GROUDON;
+            break;
+        case 11 ... 12:
+            str[pos++] = EXT_CTRL_CODE_BEGIN;
+            str[pos] = NextRandom() % 0x1A;
+            count = GetExpandedCtrlCodeArgCount(str[pos++]);
+            // Arguments are copied as is, whatever their value.
+            for (i = 0; i < count; i++)
+                str[pos++] = NextRandom() % (EOS + 1);
+            break;
+        default:
+            // Long runs of plain text, for the word copies.
+            count = min((int)(1 + NextRandom() % 16), length - pos);
+            FillRandom(str + pos, count, MAX_PLAIN_CHAR);
+            pos += count;
+            break;
+        }
+    }
+    str[pos] = EOS;
+}
+
+static void CheckExpandPlaceholders(void)
+{
+    int i, srcOffset, destOffset;
+
+    for (i = 0; i < NUM_EXPAND_STRINGS; i++)
+    {
+        int length = NextRandom() % (MAX_LENGTH * 2);
+
+        MakeText(gStringVar1, NextRandom() % 40, 4, FALSE);
+        MakeText(gStringVar2, NextRandom() % 40, 4, FALSE);
+        MakeText(gStringVar3, NextRandom() % 40, 4, FALSE);
+        MakeText(gSaveBlock2Ptr->playerName, NextRandom() % (PLAYER_NAME_LENGTH - 4), 0, FALSE);
+        gSaveBlock2Ptr->playerGender = NextRandom() % 2;
+
+        for (srcOffset = 0; srcOffset < NUM_OFFSETS; srcOffset++)
+        {
+            const u8 *src = sString1 + srcOffset;
+
+            MakeText(sString1 + srcOffset, length, 8, TRUE);
+            for (destOffset = 0; destOffset < NUM_OFFSETS; destOffset++)
+            {
+                FillDests();
+                CompareDests(OrigStringExpandPlaceholders(sOrigDest + destOffset, src),
+                             StringExpandPlaceholders(sNewDest + destOffset, src),
+                             "StringExpandPlaceholders", srcOffset, destOffset, length);
+            }
+        }
+    }
+    printf("StringExpandPlaceholders: OK\n");
+}
+
+static void CheckFill(void)
+{
+    int c, n, destOffset;
+
+    for (c = 0; c <= EOS; c++)
+    {
+        for (destOffset = 0; destOffset < NUM_OFFSETS; destOffset++)
+        {
+            for (n = 0; n <= MAX_LENGTH; n++)
+            {
+                FillDests();
+                CompareDests(OrigStringFill(sOrigDest + destOffset, c, n),
+                             StringFill(sNewDest + destOffset, c, n),
+                             "StringFill", destOffset, 0, n);
+            }
+            FillDests();
+            CompareDests(OrigStringFill(sOrigDest + destOffset, c, DEST_BUFFER_SIZE - NUM_OFFSETS - 1),
+                         StringFill(sNewDest + destOffset, c, DEST_BUFFER_SIZE - NUM_OFFSETS - 1),
+                         "StringFill", destOffset, 0, DEST_BUFFER_SIZE - NUM_OFFSETS - 1);
+        }
+    }
+    printf("StringFill: OK\n");
+}
+
+int main(void)
+{
+    CheckLengthAndCopy();
+    CheckAppend();
+    CheckCompare();
+    CheckExpandPlaceholders();
+    CheckFill();
+    printf("%lu checks, all match the original functions\n", sNumChecks);
+    return 0;
+}
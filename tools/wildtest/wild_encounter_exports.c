@@ -0,0 +1,39 @@
+// Entry points for wildtest to the static functions in src/wild_encounter.c.
+// Like wild_encounter_orig.c, this is appended to that file by the Makefile.
+
+#include "wild_encounter_exports.h"
+
+u8 NewChooseWildMonIndex_Land(void)
+{
+    return ChooseWildMonIndex_Land();
+}
+
+u8 NewChooseWildMonIndex_WaterRock(void)
+{
+    return ChooseWildMonIndex_WaterRock();
+}
+
+u8 NewChooseWildMonIndex_Fishing(u8 rod)
+{
+    return ChooseWildMonIndex_Fishing(rod);
+}
+
+u16 NewGetCurrentMapWildMonHeaderId(void)
+{
+    return GetCurrentMapWildMonHeaderId();
+}
+
+// How many rolls of the shared fishing roll fall in the rod's slots. The
+// rest are past its end.
+u16 GetFishingRodTotal(u8 rod)
+{
+    switch (rod)
+    {
+    case OLD_ROD:
+        return ENCOUNTER_CHANCE_FISHING_MONS_OLD_ROD_TOTAL;
+    case GOOD_ROD:
+        return ENCOUNTER_CHANCE_FISHING_MONS_GOOD_ROD_TOTAL;
+    default:
+        return ENCOUNTER_CHANCE_FISHING_MONS_SUPER_ROD_TOTAL;
+    }
+}
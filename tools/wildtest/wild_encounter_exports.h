@@ -0,0 +1,10 @@
+#ifndef GUARD_WILD_ENCOUNTER_EXPORTS_H
+#define GUARD_WILD_ENCOUNTER_EXPORTS_H
+
+u8 NewChooseWildMonIndex_Land(void);
+u8 NewChooseWildMonIndex_WaterRock(void);
+u8 NewChooseWildMonIndex_Fishing(u8 rod);
+u16 NewGetCurrentMapWildMonHeaderId(void);
+u16 GetFishingRodTotal(u8 rod);
+
+#endif // GUARD_WILD_ENCOUNTER_EXPORTS_H
@@ -0,0 +1,9 @@
+#ifndef GUARD_WILD_ENCOUNTER_ORIG_H
+#define GUARD_WILD_ENCOUNTER_ORIG_H
+
+u8 OrigChooseWildMonIndex_Land(void);
+u8 OrigChooseWildMonIndex_WaterRock(void);
+u8 OrigChooseWildMonIndex_Fishing(u8 rod);
+u16 OrigGetCurrentMapWildMonHeaderId(void);
+
+#endif // GUARD_WILD_ENCOUNTER_ORIG_H
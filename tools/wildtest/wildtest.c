@@ -0,0 +1,205 @@
+// wildtest - checks the wild slot and header lookups in src/wild_encounter.c
+// against the original versions they replaced (wild_encounter_orig.c).
+//
+// Usage:
+//   wildtest [name]
+//       Exits with 1 after printing the first mismatch, if any. name is only
+//       used to label the output, the Makefile passes the variant's name.
+//
+// Checked:
+//   - The land, water/rock smash and fishing slot picks give the same slot
+//     for every value Random() can return, with each rod. The Makefile also
+//     builds a variant where the rods have different totals, so the shared
+//     fishing roll goes past the end of the old and good rods' slots.
+//   - The wild header lookup gives the same header for every map, and for
+//     random walks between maps that revisit the same map, which is where
+//     the per-map cache is used. Altering Cave is checked with every wild set
+//     number, including ones past NUM_ALTERING_CAVE_TABLES.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "global.h"
+#include "random.h"
+#include "wild_encounter.h"
+#include "constants/items.h"
+#include "constants/maps.h"
+#include "constants/vars.h"
+#include "wild_encounter_orig.h"
+#include "wild_encounter_exports.h"
+
+#define FATAL_ERROR(format, ...)            \
+do                                          \
+{                                           \
+    fprintf(stderr, format, ##__VA_ARGS__); \
+    exit(1);                                \
+} while (0)
+
+// The same as in src/wild_encounter.c.
+#define HEADER_NONE 0xFFFF
+
+#define NUM_MAP_NUMS 128
+#define NUM_WALK_STEPS 1000000
+
+static struct SaveBlock1 sSaveBlock1;
+
+struct SaveBlock1 *gSaveBlock1Ptr = &sSaveBlock1;
+
+static u16 sNextRandom;
+static u16 sAlteringCaveWildSet;
+
+// The game functions the lookups call.
+u16 Random(void)
+{
+    return sNextRandom;
+}
+
+u16 VarGet(u16 id)
+{
+    if (id != VAR_ALTERING_CAVE_WILD_SET)
+        FATAL_ERROR("VarGet called with unexpected var 0x%X\n", id);
+    return sAlteringCaveWildSet;
+}
+
+static u32 sRngState = 0x12345678;
+
+static u32 NextRandom(void)
+{
+    sRngState ^= sRngState << 13;
+    sRngState ^= sRngState >> 17;
+    sRngState ^= sRngState << 5;
+    return sRngState;
+}
+
+static const char *const sRodNames[] = {
+    [OLD_ROD] = "old rod",
+    [GOOD_ROD] = "good rod",
+    [SUPER_ROD] = "super rod",
+};
+
+static void CheckSlots(const char *name)
+{
+    u32 value;
+    u8 rod;
+    u16 numFishingRolls = 0;
+    u32 numPastTotal[SUPER_ROD + 1] = {0};
+
+    for (rod = OLD_ROD; rod <= SUPER_ROD; rod++)
+        numFishingRolls = max(numFishingRolls, GetFishingRodTotal(rod));
+
+    for (value = 0; value <= 0xFFFF; value++)
+    {
+        u8 slot, expected;
+
+        sNextRandom = value;
+
+        slot = NewChooseWildMonIndex_Land();
+        expected = OrigChooseWildMonIndex_Land();
+        if (slot != expected)
+            FATAL_ERROR("%s: land roll 0x%04X gives slot %u, expected %u\n", name, value, slot, expected);
+
+        slot = NewChooseWildMonIndex_WaterRock();
+        expected = OrigChooseWildMonIndex_WaterRock();
+        if (slot != expected)
+            FATAL_ERROR("%s: water/rock smash roll 0x%04X gives slot %u, expected %u\n", name, value, slot, expected);
+
+        for (rod = OLD_ROD; rod <= SUPER_ROD; rod++)
+        {
+            slot = NewChooseWildMonIndex_Fishing(rod);
+            expected = OrigChooseWildMonIndex_Fishing(rod);
+            if (slot != expected)
+                FATAL_ERROR("%s: %s roll 0x%04X gives slot %u, expected %u\n", name, sRodNames[rod], value, slot, expected);
+            if (value % numFishingRolls >= GetFishingRodTotal(rod))
+                numPastTotal[rod]++;
+        }
+    }
+
+    for (rod = OLD_ROD; rod <= SUPER_ROD; rod++)
+        printf("%s: %s has %u of %u fishing rolls, %u Random() values were past them.\n",
+               name, sRodNames[rod], GetFishingRodTotal(rod), numFishingRolls, numPastTotal[rod]);
+}
+
+static void CheckHeader(const char *name, u8 mapGroup, u8 mapNum)
+{
+    u16 headerId, expected;
+
+    gSaveBlock1Ptr->location.mapGroup = mapGroup;
+    gSaveBlock1Ptr->location.mapNum = mapNum;
+
+    headerId = NewGetCurrentMapWildMonHeaderId();
+    expected = OrigGetCurrentMapWildMonHeaderId();
+    if (headerId != expected)
+        FATAL_ERROR("%s: map %u.%u with wild set %u gives header 0x%X, expected 0x%X\n",
+                    name, mapGroup, mapNum, sAlteringCaveWildSet, headerId, expected);
+}
+
+static void CheckHeaders(const char *name)
+{
+    u32 mapGroup, mapNum, step;
+    u32 numHeaders, numWithHeader = 0;
+
+    for (numHeaders = 0; gWildMonHeaders[numHeaders].mapGroup != MAP_GROUP(MAP_UNDEFINED); numHeaders++)
+        ;
+
+    // Every map in order, twice each, so the second lookup hits the cache.
+    for (mapGroup = 0; mapGroup < MAP_GROUPS_COUNT; mapGroup++)
+    {
+        for (mapNum = 0; mapNum < NUM_MAP_NUMS; mapNum++)
+        {
+            CheckHeader(name, mapGroup, mapNum);
+            CheckHeader(name, mapGroup, mapNum);
+            if (NewGetCurrentMapWildMonHeaderId() != HEADER_NONE)
+                numWithHeader++;
+        }
+    }
+
+    // Altering Cave with every wild set, without leaving the map.
+    for (sAlteringCaveWildSet = 0; sAlteringCaveWildSet < NUM_ALTERING_CAVE_TABLES + 4; sAlteringCaveWildSet++)
+        CheckHeader(name, MAP_GROUP(MAP_ALTERING_CAVE), MAP_NUM(MAP_ALTERING_CAVE));
+    sAlteringCaveWildSet = 0xFFFF;
+    CheckHeader(name, MAP_GROUP(MAP_ALTERING_CAVE), MAP_NUM(MAP_ALTERING_CAVE));
+
+    // Random walks, mostly between maps with wild mons, staying on each for a
+    // few steps and changing the Altering Cave set along the way.
+    for (step = 0; step < NUM_WALK_STEPS; step++)
+    {
+        u32 stay;
+
+        switch (NextRandom() % 4)
+        {
+        case 0:
+            mapGroup = MAP_GROUP(MAP_ALTERING_CAVE);
+            mapNum = MAP_NUM(MAP_ALTERING_CAVE);
+            break;
+        case 1:
+            mapGroup = NextRandom() % MAP_GROUPS_COUNT;
+            mapNum = NextRandom() % NUM_MAP_NUMS;
+            break;
+        default:
+        {
+            const struct WildPokemonHeader *header = &gWildMonHeaders[NextRandom() % numHeaders];
+            mapGroup = header->mapGroup;
+            mapNum = header->mapNum;
+            break;
+        }
+        }
+
+        for (stay = 1 + NextRandom() % 3; stay != 0; stay--)
+        {
+            if (NextRandom() % 8 == 0)
+                sAlteringCaveWildSet = NextRandom() % (NUM_ALTERING_CAVE_TABLES + 2);
+            CheckHeader(name, mapGroup, mapNum);
+        }
+    }
+
+    printf("%s: %u maps have wild mons, out of %u headers.\n", name, numWithHeader, numHeaders);
+}
+
+int main(int argc, char **argv)
+{
+    const char *name = argc > 1 ? argv[1] : "wildtest";
+
+    CheckSlots(name);
+    CheckHeaders(name);
+
+    return 0;
+}